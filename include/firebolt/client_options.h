@@ -0,0 +1,176 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <firebolt/types.h>
+#include <functional>
+#include <string>
+
+namespace Firebolt
+{
+/**
+ * @brief Where event callbacks run
+ */
+enum class EventDispatch
+{
+    INLINE, // On the transport's receive thread, delaying every response and event behind the callback
+    THREAD, // On one dispatch thread, in the order the events arrived
+    POOL,   // On a pool of ClientOptions::eventDispatchThreads threads, in order for each event
+    // On the application's thread, from IFireboltAccessorExtensions::DispatchPending(), in the order the events
+    // arrived. IFireboltAccessorExtensions::EventFd() is readable while events are pending, for the application's
+    // main loop to poll.
+    MAIN_LOOP,
+};
+
+/**
+ * @brief Which events of a subscription are delivered, see IFireboltAccessorExtensions::SetEventDelivery()
+ */
+enum class EventDelivery
+{
+    ALL, // Every event, in the order they arrived
+    // Only the newest of the events still waiting for delivery, for events that only matter at their latest value.
+    // Makes no difference with EventDispatch::INLINE, where no event waits.
+    CONFLATE,
+};
+
+/**
+ * @brief Statistics of event delivery, see IFireboltAccessorExtensions::EventDispatchStatistics()
+ */
+struct EventDispatchStats
+{
+    std::size_t queueDepth = 0;    // Deliveries waiting for a dispatch thread or DispatchPending()
+    std::size_t maxQueueDepth = 0; // Highest queueDepth seen
+    uint64_t delivered = 0;        // Events handed to their callbacks
+    uint64_t conflated = 0;        // Events replaced by a newer one before delivery, see EventDelivery::CONFLATE
+    uint64_t duplicates = 0;       // Events dropped as equal to the last one delivered, see SetDistinctUntilChanged()
+    std::chrono::microseconds totalCallbackTime{0}; // Time spent decoding events and in their callbacks
+    std::chrono::microseconds maxCallbackTime{0};
+    std::chrono::microseconds maxQueueDelay{0}; // Longest wait between the arrival of an event and its delivery
+};
+
+/**
+ * @brief Client-side options, complementing the transport's Firebolt::Config
+ */
+struct ClientOptions
+{
+    /**
+     * @brief Serve getters that have a matching change event from a local cache.
+     *        The first read fetches the value and subscribes to the event, later reads are answered
+     *        locally and kept up to date by the event stream. The cache is dropped on connection changes.
+     */
+    bool propertyCache = false;
+
+    /**
+     * @brief Extrapolate Device.uptime and Device.timeInActiveState locally from the monotonic clock.
+     *        The counters are sampled once and resampled after this interval and on connection changes.
+     *        Zero (the default) fetches them on every call.
+     */
+    std::chrono::milliseconds clockResyncInterval{0};
+
+    /**
+     * @brief Maximum number of worker threads running IFireboltAccessorExtensions::Async() and Batch()
+     *        requests. Requests are not pipelined: each one blocks its worker until the response arrives, so
+     *        this is also how many of them can be in flight at once. Connect() fails with Error::InvalidParams
+     *        if zero.
+     */
+    std::size_t asyncWorkers = 4;
+
+    /**
+     * @brief Where event callbacks run. With THREAD or POOL, a slow callback only delays the events after it
+     *        (for POOL, those of the same event) instead of the transport. Applies to events arriving later.
+     *        Unsubscribing waits for a callback of the listener running on another thread, so it must not be
+     *        called while holding a lock that the callback takes.
+     */
+    EventDispatch eventDispatch = EventDispatch::INLINE;
+
+    /**
+     * @brief Number of threads delivering events with EventDispatch::POOL, at least one
+     */
+    std::size_t eventDispatchThreads = 2;
+
+    /**
+     * @brief Callback reporting a failed queued Metrics call
+     *
+     * @param method : Name of the method, e.g. "Metrics.mediaPlaying"
+     * @param error  : Error of the call
+     */
+    using MetricsErrorCallback = std::function<void(const std::string& method, Firebolt::Error error)>;
+
+    /**
+     * @brief Make Metrics calls fire-and-forget. A call is queued and returns at once, a background thread
+     *        sends it; failures are reported to onMetricsError. A call fails only if the queue is full.
+     */
+    bool metricsQueue = false;
+
+    /**
+     * @brief Maximum number of queued Metrics calls, rounded up to a power of two
+     */
+    std::size_t metricsQueueCapacity = 256;
+
+    /**
+     * @brief How long the calls still queued are sent for once the queue is dropped, when reconnecting with other
+     *        options or on shutdown. The calls left after that are reported to onMetricsError with Error::Timedout.
+     */
+    std::chrono::milliseconds metricsDrainTimeout{1000};
+
+    /**
+     * @brief With metricsQueue, drop redundant consecutive queued Metrics calls for the same entity before
+     *        sending: a repeated media state event (e.g. mediaPlaying) is sent once, of a run of rate or
+     *        rendition changes only the last. Calls already waiting in the queue are coalesced together.
+     */
+    bool metricsCoalesce = false;
+
+    /**
+     * @brief With metricsCoalesce, hold a queued call back this long for later calls to coalesce with, up to
+     *        metricsCoalesceLimit calls. Calls are still sent one by one, there is no JSON-RPC batch: the delay
+     *        pays off only by dropping redundant ones. Ignored without metricsCoalesce. Zero (the default) does
+     *        not wait.
+     */
+    std::chrono::milliseconds metricsCoalesceDelay{0};
+
+    /**
+     * @brief Maximum number of Metrics calls coalesced together
+     */
+    std::size_t metricsCoalesceLimit = 32;
+
+    /**
+     * @brief Optional callback for queued Metrics calls that failed
+     */
+    MetricsErrorCallback onMetricsError;
+
+    /**
+     * @brief Directory for the outbox files. When set, Metrics calls and Discovery.watched calls that cannot
+     *        be delivered because the connection is down are stored on disk and replayed after reconnecting.
+     *        Calls stored this way succeed, Discovery.watched then returns true, so that retrying them does not
+     *        send them twice. Stored calls that cannot be read back on replay are dropped.
+     *        Each process needs a directory of its own: the files are locked while open, and the outbox stays
+     *        disabled in a process that finds them locked by another one.
+     *        Empty (the default) disables the outbox.
+     */
+    std::string outboxDirectory;
+
+    /**
+     * @brief Size in bytes of each outbox file. When full, the oldest calls are dropped.
+     */
+    std::size_t outboxSize = 256 * 1024;
+};
+} // namespace Firebolt
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/**
+ * Optional C++20 coroutine layer over IFireboltAccessorExtensions::Async().
+ * Header-only; available when compiling with coroutine support, empty otherwise.
+ *
+ *     Firebolt::Result<std::string> uid = co_await Firebolt::Awaitable(
+ *         accessor, [&] { return accessor.DeviceInterface().uid(); }, executor);
+ *
+ * The coroutine is suspended while the request is in flight and resumed through the executor,
+ * any callable taking a std::function<void()> (e.g. posting it to the application's event loop).
+ * Without an executor, it resumes directly on the worker thread that completed the request.
+ *
+ * The awaiting thread is free while the coroutine is suspended, but this is not pipelining: the request
+ * itself still blocks one of Async()'s pool workers for its whole round trip, so at most
+ * ClientOptions::asyncWorkers requests are awaited at once and the others wait for a worker.
+ */
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include "firebolt/firebolt.h"
+#include <coroutine>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Firebolt
+{
+/**
+ * @brief Resumes the awaiting coroutine on the thread that completed the request
+ */
+struct InlineResume
+{
+    void operator()(std::function<void()> resume) const { resume(); }
+};
+
+/**
+ * @brief Awaitable performing one interface call through IFireboltAccessorExtensions::Async()
+ *
+ * @tparam Request : Callable performing the interface call
+ * @tparam Resume  : Executor resuming the coroutine
+ */
+template <typename Request, typename Resume = InlineResume> class Awaitable
+{
+public:
+    using ResultType = std::invoke_result_t<Request&>;
+
+    Awaitable(IFireboltAccessorExtensions& accessor, Request request, Resume resume = Resume{})
+        : accessor_(accessor),
+          request_(std::move(request)),
+          resume_(std::move(resume))
+    {
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The executor is copied: once the coroutine resumes, this awaitable may be gone
+        accessor_.Async(std::move(request_),
+                        [this, handle, resume = resume_](ResultType result) mutable
+                        {
+                            result_.emplace(std::move(result));
+                            resume([handle] { handle.resume(); });
+                        });
+    }
+
+    ResultType await_resume() { return std::move(*result_); }
+
+private:
+    IFireboltAccessorExtensions& accessor_;
+    Request request_;
+    Resume resume_;
+    std::optional<ResultType> result_;
+};
+
+template <typename Request> Awaitable(IFireboltAccessorExtensions&, Request) -> Awaitable<Request>;
+template <typename Request, typename Resume>
+Awaitable(IFireboltAccessorExtensions&, Request, Resume) -> Awaitable<Request, Resume>;
+} // namespace Firebolt
+
+#endif
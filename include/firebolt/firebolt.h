@@ -22,6 +22,7 @@
 #include "firebolt/actions.h"
 #include "firebolt/advertising.h"
 #include "firebolt/client_export.h"
+#include "firebolt/client_options.h"
 #include "firebolt/device.h"
 #include "firebolt/discovery.h"
 #include "firebolt/display.h"
@@ -34,7 +35,15 @@
 #include "firebolt/texttospeech.h"
 #include <firebolt/config.h>
 #include <firebolt/types.h>
+#include <cstddef>
 #include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Firebolt
 {
@@ -170,4 +179,175 @@ public:
      */
     virtual Actions::IActions& ActionsInterface() = 0;
 };
+
+/**
+ * @brief Client functions added after IFireboltAccessor, implemented by the same singleton.
+ *        They live in an interface of their own so that the vtable of IFireboltAccessor, and with it the ABI
+ *        of applications built against it, is unchanged. New functions are appended at the end.
+ */
+class FIREBOLTCLIENT_EXPORT IFireboltAccessorExtensions
+{
+public:
+    virtual ~IFireboltAccessorExtensions() = default;
+
+    /**
+     * @brief Get the extensions of the FireboltAccessor singleton instance
+     *
+     * @return The same object as IFireboltAccessor::Instance(), seen through this interface
+     */
+    static IFireboltAccessorExtensions& Instance();
+
+    /**
+     * @brief Same as IFireboltAccessor::Connect(config, listener), additionally applying client-side options.
+     *        The options apply to all interfaces, including those already obtained.
+     *
+     * @param config   : Configuration parameters
+     * @param options  : Client-side options
+     * @param listener : Connection status listener
+     *
+     * @return Firebolt::Error
+     */
+    virtual Firebolt::Error Connect(const Firebolt::Config& config, const ClientOptions& options,
+                                    IFireboltAccessor::OnConnectionChanged listener) = 0;
+
+    /**
+     * @brief Returns statistics of event delivery: the depth of the dispatch queue and the time spent in
+     *        callbacks, see ClientOptions::eventDispatch
+     *
+     * @return Statistics since the client was created
+     */
+    virtual EventDispatchStats EventDispatchStatistics() const = 0;
+
+    /**
+     * @brief Returns a file descriptor for the application's main loop to poll when ClientOptions::eventDispatch
+     *        is EventDispatch::MAIN_LOOP. It is readable while events wait for DispatchPending().
+     *        The descriptor belongs to the client and stays the same for its lifetime, do not read or close it.
+     *
+     * @return The file descriptor, or -1 if events are not delivered from the application's main loop
+     */
+    virtual int EventFd() const = 0;
+
+    /**
+     * @brief Delivers events that wait for the application's main loop, on the calling thread and in the order
+     *        they arrived
+     *
+     * @param[in] maxEvents : Most events to deliver in this call, the rest keep EventFd() readable
+     *
+     * @return Number of events delivered
+     */
+    virtual std::size_t DispatchPending(std::size_t maxEvents) = 0;
+
+    /**
+     * @brief Sets which events a subscription receives while deliveries are queued behind a busy callback.
+     *        With EventDelivery::CONFLATE the events still waiting collapse to the newest one, which suits
+     *        events that only matter at their latest value, e.g. Presentation.onFocusedChanged.
+     *
+     * @param[in] id       : Subscription id returned by one of the subscribe methods
+     * @param[in] delivery : Delivery policy for the events arriving from now on
+     *
+     * @return Error::General if id is not a subscription of an interface of this client
+     */
+    virtual Result<void> SetEventDelivery(SubscriptionId id, EventDelivery delivery) = 0;
+
+    /**
+     * @brief Makes a subscription skip events whose payload equals the last one it received, e.g. settings
+     *        re-emitted unchanged by the platform. Repeats are dropped before they are decoded.
+     *
+     * @param[in] id       : Subscription id returned by one of the subscribe methods
+     * @param[in] distinct : Whether repeated events are dropped, from the next event on
+     *
+     * @return Error::General if id is not a subscription of an interface of this client
+     */
+    virtual Result<void> SetDistinctUntilChanged(SubscriptionId id, bool distinct) = 0;
+
+    /**
+     * @brief Performs several independent requests at once and returns when all of them completed.
+     *        This is not a JSON-RPC batch: each request is still a call of its own, blocking the thread
+     *        running it. The requests run on the worker pool of Async() and on the calling thread, so up to
+     *        ClientOptions::asyncWorkers + 1 of them are in flight together; a larger batch takes several
+     *        round trips. Each request keeps its own Result.
+     *
+     *        auto [captions, language, hdr] = accessor.Batch(
+     *            [&] { return accessor.AccessibilityInterface().closedCaptionsSettings(); },
+     *            [&] { return accessor.LocalizationInterface().presentationLanguage(); },
+     *            [&] { return accessor.DeviceInterface().hdr(); });
+     *
+     * @param requests : Callables, each performing one interface call
+     *
+     * @return Tuple of the requests' results, in the order of the requests
+     */
+    template <typename... Requests> std::tuple<std::invoke_result_t<Requests&>...> Batch(Requests&&... requests)
+    {
+        std::tuple<std::optional<std::invoke_result_t<Requests&>>...> results;
+        std::tuple<Requests&...> callables{requests...};
+        std::vector<std::function<void()>> tasks =
+            batchTasks(results, callables, std::index_sequence_for<Requests...>{});
+        RunBatch(tasks);
+        return std::apply([](auto&... result) { return std::make_tuple(std::move(*result)...); }, results);
+    }
+
+    /**
+     * @brief Performs a request without blocking the caller, e.g.
+     *
+     *        auto uid = accessor.Async([&] { return accessor.DeviceInterface().uid(); });
+     *
+     *        This moves the blocking call to a bounded pool of worker threads, see ClientOptions::asyncWorkers.
+     *        The request still blocks its worker for the whole round trip, so it is not pipelined: at most
+     *        asyncWorkers requests are in flight at once and the others wait in the pool's queue.
+     *        A request must not wait for the future of another Async() request: once all asyncWorkers
+     *        workers wait like this, nothing runs the requests they wait for and they deadlock.
+     *
+     * @param request : Callable performing one interface call
+     *
+     * @return Future of the request's result
+     */
+    template <typename Request> std::future<std::invoke_result_t<std::decay_t<Request>&>> Async(Request&& request)
+    {
+        using ResultType = std::invoke_result_t<std::decay_t<Request>&>;
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Request>(request));
+        auto future = task->get_future();
+        Post([task] { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Performs a request without blocking the caller and passes its result to a completion callback.
+     *        The callback is called on a worker thread.
+     *
+     * @param request    : Callable performing one interface call
+     * @param onComplete : Callback receiving the request's result
+     */
+    template <typename Request, typename OnComplete> void Async(Request&& request, OnComplete&& onComplete)
+    {
+        auto state = std::make_shared<std::pair<std::decay_t<Request>, std::decay_t<OnComplete>>>(
+            std::forward<Request>(request), std::forward<OnComplete>(onComplete));
+        Post([state] { state->second(state->first()); });
+    }
+
+protected:
+    /**
+     * @brief Queues a task of Async() on the worker pool
+     *
+     * @param task : Task to run
+     */
+    virtual void Post(std::function<void()> task) = 0;
+
+    /**
+     * @brief Runs the tasks of a Batch() concurrently, returns when all of them completed
+     *
+     * @param tasks : Tasks to run
+     */
+    virtual void RunBatch(std::vector<std::function<void()>>& tasks) = 0;
+
+private:
+    template <typename Results, typename Callables, std::size_t... I>
+    static std::vector<std::function<void()>> batchTasks(Results& results, Callables& callables,
+                                                         std::index_sequence<I...>)
+    {
+        std::vector<std::function<void()>> tasks;
+        tasks.reserve(sizeof...(I));
+        (tasks.emplace_back([&results, &callables] { std::get<I>(results).emplace(std::get<I>(callables)()); }), ...);
+        return tasks;
+    }
+};
 } // namespace Firebolt
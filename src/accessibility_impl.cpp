@@ -17,62 +17,68 @@
  */
 
 #include "accessibility_impl.h"
-#include "json_types/accessibility.h"
+
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Accessibility
 {
 AccessibilityImpl::AccessibilityImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper),
-      subscriptionManager_(helper, this)
+      subscriptionManager_(helper, this),
+      audioDescription_(helper, Method::AccessibilityAudioDescription, Method::AccessibilityOnAudioDescriptionChanged),
+      closedCaptionsSettings_(helper, Method::AccessibilityClosedCaptionsSettings,
+                              Method::AccessibilityOnClosedCaptionsSettingsChanged),
+      highContrastUI_(helper, Method::AccessibilityHighContrastUI, Method::AccessibilityOnHighContrastUIChanged),
+      voiceGuidanceSettings_(helper, Method::AccessibilityVoiceGuidanceSettings,
+                             Method::AccessibilityOnVoiceGuidanceSettingsChanged)
 {
 }
 
 Result<bool> AccessibilityImpl::audioDescription() const
 {
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Accessibility.audioDescription");
+    return audioDescription_.get();
 }
 
 Result<SubscriptionId> AccessibilityImpl::subscribeOnAudioDescriptionChanged(std::function<void(bool)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean, bool>("Accessibility.onAudioDescriptionChanged",
+    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean, bool>(Method::AccessibilityOnAudioDescriptionChanged,
                                                                          std::move(notification));
 }
 
 Result<ClosedCaptionsSettings> AccessibilityImpl::closedCaptionsSettings() const
 {
-    return helper_.get<JsonData::ClosedCaptionsSettings, ClosedCaptionsSettings>(
-        "Accessibility.closedCaptionsSettings");
+    return closedCaptionsSettings_.get();
 }
 
 Result<SubscriptionId> AccessibilityImpl::subscribeOnClosedCaptionsSettingsChanged(
     std::function<void(const ClosedCaptionsSettings&)>&& notification)
 {
     return subscriptionManager_
-        .subscribe<JsonData::ClosedCaptionsSettings>("Accessibility.onClosedCaptionsSettingsChanged",
+        .subscribe<JsonData::ClosedCaptionsSettings>(Method::AccessibilityOnClosedCaptionsSettingsChanged,
                                                      std::move(notification));
 }
 
 Result<bool> AccessibilityImpl::highContrastUI() const
 {
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Accessibility.highContrastUI");
+    return highContrastUI_.get();
 }
 
 Result<SubscriptionId> AccessibilityImpl::subscribeOnHighContrastUIChanged(std::function<void(bool)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean, bool>("Accessibility.onHighContrastUIChanged",
+    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean, bool>(Method::AccessibilityOnHighContrastUIChanged,
                                                                          std::move(notification));
 }
 
 Result<VoiceGuidanceSettings> AccessibilityImpl::voiceGuidanceSettings() const
 {
-    return helper_.get<JsonData::VoiceGuidanceSettings, VoiceGuidanceSettings>("Accessibility.voiceGuidanceSettings");
+    return voiceGuidanceSettings_.get();
 }
 
 Result<SubscriptionId> AccessibilityImpl::subscribeOnVoiceGuidanceSettingsChanged(
     std::function<void(const VoiceGuidanceSettings&)>&& notification)
 {
     return subscriptionManager_
-        .subscribe<JsonData::VoiceGuidanceSettings>("Accessibility.onVoiceGuidanceSettingsChanged",
+        .subscribe<JsonData::VoiceGuidanceSettings>(Method::AccessibilityOnVoiceGuidanceSettingsChanged,
                                                     std::move(notification));
 }
 
@@ -85,4 +91,20 @@ void AccessibilityImpl::unsubscribeAll()
 {
     subscriptionManager_.unsubscribeAll();
 }
+
+void AccessibilityImpl::configure(const ClientOptions& options)
+{
+    audioDescription_.setEnabled(options.propertyCache);
+    closedCaptionsSettings_.setEnabled(options.propertyCache);
+    highContrastUI_.setEnabled(options.propertyCache);
+    voiceGuidanceSettings_.setEnabled(options.propertyCache);
+}
+
+void AccessibilityImpl::onConnectionChanged(bool /*connected*/)
+{
+    audioDescription_.invalidate();
+    closedCaptionsSettings_.invalidate();
+    highContrastUI_.invalidate();
+    voiceGuidanceSettings_.invalidate();
+}
 } // namespace Firebolt::Accessibility
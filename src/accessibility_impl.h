@@ -18,7 +18,11 @@
 
 #pragma once
 
+#include "cached_property.h"
 #include "firebolt/accessibility.h"
+#include "firebolt/client_options.h"
+#include "json_decode.h"
+#include "json_types/accessibility.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::Accessibility
@@ -50,8 +54,18 @@ public:
     virtual Result<void> unsubscribe(SubscriptionId id) override;
     virtual void unsubscribeAll() override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
+
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::Boolean, bool> audioDescription_;
+    mutable Firebolt::Internal::CachedProperty<JsonData::ClosedCaptionsSettings, ClosedCaptionsSettings>
+        closedCaptionsSettings_;
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::Boolean, bool> highContrastUI_;
+    mutable Firebolt::Internal::CachedProperty<JsonData::VoiceGuidanceSettings, VoiceGuidanceSettings>
+        voiceGuidanceSettings_;
 };
 } // namespace Firebolt::Accessibility
@@ -23,6 +23,8 @@
 #include "json_types/actions.h"
 #include <firebolt/json_types.h>
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Actions
 {
 
@@ -34,12 +36,12 @@ ActionsImpl::ActionsImpl(Firebolt::Helpers::IHelper& helper)
 
 Result<std::string> ActionsImpl::intent() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Actions.intent");
+    return Firebolt::Internal::get<Firebolt::JSON::String, std::string>(helper_, Method::ActionsIntent);
 }
 
 Result<SubscriptionId> ActionsImpl::subscribeOnIntent(std::function<void(const std::string&)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::String>("Actions.onIntent", std::move(notification));
+    return subscriptionManager_.subscribe<Firebolt::JSON::String>(Method::ActionsOnIntent, std::move(notification));
 }
 
 Result<void> ActionsImpl::unsubscribe(SubscriptionId id)
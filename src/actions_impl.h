@@ -23,6 +23,7 @@
 #define FIREBOLT_ACTIONS_IMPL_H
 
 #include "firebolt/actions.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::Actions
@@ -45,7 +46,7 @@ public:
 
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
 };
 
 } // namespace Firebolt::Actions
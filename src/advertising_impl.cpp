@@ -19,6 +19,8 @@
 #include "advertising_impl.h"
 #include "json_types/advertising.h"
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Advertising
 {
 AdvertisingImpl::AdvertisingImpl(Firebolt::Helpers::IHelper& helper)
@@ -28,7 +30,7 @@ AdvertisingImpl::AdvertisingImpl(Firebolt::Helpers::IHelper& helper)
 
 Result<Ifa> AdvertisingImpl::advertisingId() const
 {
-    return helper_.get<JsonData::IfaJson, Ifa>("Advertising.advertisingId");
+    return Firebolt::Internal::get<JsonData::IfaJson, Ifa>(helper_, Method::AdvertisingAdvertisingId);
 }
 
 } // namespace Firebolt::Advertising
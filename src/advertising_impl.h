@@ -19,6 +19,7 @@
 #pragma once
 
 #include "firebolt/advertising.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::Advertising
@@ -0,0 +1,226 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "json_decode.h"
+#include "methods.h"
+#include <atomic>
+#include <cstdint>
+#include <firebolt/helpers.h>
+#include <mutex>
+#include <optional>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief A property getter that can be served from a local copy kept up to date by its change event
+ *
+ * While disabled, get() is a plain Internal::get<>() round trip. Once enabled, the first get() subscribes
+ * to the change event and fetches the value; later calls return the locally kept value, which the event
+ * stream updates. The subscription uses its own SubscriptionManager, so it is not affected by the
+ * interface's unsubscribeAll().
+ */
+template <typename JsonType, typename PropertyType> class CachedProperty
+{
+public:
+    CachedProperty(Firebolt::Helpers::IHelper& helper, Method getter, Method onChanged)
+        : helper_(helper),
+          subscriptionManager_(helper, this),
+          getter_(getter),
+          onChanged_(onChanged)
+    {
+    }
+    CachedProperty(const CachedProperty&) = delete;
+    CachedProperty& operator=(const CachedProperty&) = delete;
+
+    ~CachedProperty() { subscriptionManager_.unsubscribeAll(); }
+
+    void setEnabled(bool enabled)
+    {
+        enabled_.store(enabled);
+        if (!enabled)
+        {
+            invalidate();
+            std::lock_guard subscribeLock{subscribeMutex_};
+            unsubscribe();
+        }
+    }
+
+    /**
+     * @brief Drops the cached value; the next get() fetches it again and renews the subscription.
+     *        Makes no calls into the helper, so it is safe to call from the transport's callbacks.
+     */
+    void invalidate()
+    {
+        std::lock_guard lock{mutex_};
+        value_.reset();
+        ++generation_;
+    }
+
+    Result<PropertyType> get()
+    {
+        if (!enabled_.load())
+        {
+            return Firebolt::Internal::get<JsonType, PropertyType>(helper_, getter_);
+        }
+
+        uint64_t generation;
+        {
+            std::lock_guard lock{mutex_};
+            if (value_)
+            {
+                return Result<PropertyType>{*value_};
+            }
+            generation = generation_;
+        }
+
+        // The subscription is made before fetching, so no change can be missed between the two
+        bool subscribed = subscribe();
+
+        Result<PropertyType> result = Firebolt::Internal::get<JsonType, PropertyType>(helper_, getter_);
+        if (result && subscribed)
+        {
+            std::lock_guard lock{mutex_};
+            // A value delivered by the event meanwhile is newer than the response, keep it
+            if (!value_ && generation == generation_)
+            {
+                value_ = *result;
+            }
+        }
+        return result;
+    }
+
+private:
+    bool subscribe()
+    {
+        std::lock_guard subscribeLock{subscribeMutex_};
+        uint64_t generation;
+        {
+            std::lock_guard lock{mutex_};
+            generation = generation_;
+        }
+        if (subscribed_ && subscribedGeneration_ != generation)
+        {
+            unsubscribe();
+        }
+        if (!subscribed_)
+        {
+            auto id = subscriptionManager_.subscribe<JsonType, PropertyType>(
+                onChanged_, std::function<void(const PropertyType&)>(
+                                [this, generation](const PropertyType& value)
+                                {
+                                    std::lock_guard lock{mutex_};
+                                    // Events still in flight after invalidate() must not repopulate the cache
+                                    if (generation == generation_)
+                                    {
+                                        value_ = value;
+                                    }
+                                }));
+            subscribed_ = static_cast<bool>(id);
+            subscribedGeneration_ = generation;
+        }
+        return subscribed_;
+    }
+
+    void unsubscribe()
+    {
+        if (subscribed_)
+        {
+            subscriptionManager_.unsubscribeAll();
+            subscribed_ = false;
+        }
+    }
+
+private:
+    Firebolt::Helpers::IHelper& helper_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
+    const Method getter_;
+    const Method onChanged_;
+
+    std::atomic<bool> enabled_{false};
+
+    std::mutex subscribeMutex_;
+    bool subscribed_ = false;
+    uint64_t subscribedGeneration_ = 0;
+
+    std::mutex mutex_;
+    std::optional<PropertyType> value_;
+    uint64_t generation_ = 0;
+};
+
+/**
+ * @brief A property that does not change during a connection, fetched once and then served locally
+ *
+ * Only successful results are kept. invalidate() is called when the connection changes.
+ */
+template <typename JsonType, typename PropertyType> class MemoizedProperty
+{
+public:
+    MemoizedProperty(Firebolt::Helpers::IHelper& helper, Method getter)
+        : helper_(helper),
+          getter_(getter)
+    {
+    }
+    MemoizedProperty(const MemoizedProperty&) = delete;
+    MemoizedProperty& operator=(const MemoizedProperty&) = delete;
+
+    /**
+     * @brief Drops the stored value. Makes no calls into the helper.
+     */
+    void invalidate()
+    {
+        std::lock_guard lock{mutex_};
+        value_.reset();
+        ++generation_;
+    }
+
+    Result<PropertyType> get()
+    {
+        uint64_t generation;
+        {
+            std::lock_guard lock{mutex_};
+            if (value_)
+            {
+                return Result<PropertyType>{*value_};
+            }
+            generation = generation_;
+        }
+
+        Result<PropertyType> result = Firebolt::Internal::get<JsonType, PropertyType>(helper_, getter_);
+        if (result)
+        {
+            std::lock_guard lock{mutex_};
+            // A response that raced with a connection change may belong to the previous connection
+            if (generation == generation_)
+            {
+                value_ = *result;
+            }
+        }
+        return result;
+    }
+
+private:
+    Firebolt::Helpers::IHelper& helper_;
+    const Method getter_;
+
+    std::mutex mutex_;
+    std::optional<PropertyType> value_;
+    uint64_t generation_ = 0;
+};
+} // namespace Firebolt::Internal
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "device_clock.h"
+#include <firebolt/json_types.h>
+
+using Firebolt::Internal::Method;
+
+namespace Firebolt::Device
+{
+DeviceClock::DeviceClock(Firebolt::Helpers::IHelper& helper)
+    : helper_(helper)
+{
+}
+
+void DeviceClock::setResyncInterval(std::chrono::milliseconds interval)
+{
+    resyncInterval_ms_.store(interval.count());
+    invalidate();
+}
+
+Result<uint32_t> DeviceClock::uptime()
+{
+    return read(uptime_, Method::DeviceUptime);
+}
+
+Result<uint32_t> DeviceClock::timeInActiveState()
+{
+    return read(timeInActiveState_, Method::DeviceTimeInActiveState);
+}
+
+void DeviceClock::invalidate()
+{
+    std::lock_guard lock{mutex_};
+    uptime_.valid = false;
+    timeInActiveState_.valid = false;
+    ++generation_;
+}
+
+Result<uint32_t> DeviceClock::read(Anchor& anchor, Method getter)
+{
+    const std::chrono::milliseconds resyncInterval{resyncInterval_ms_.load()};
+    auto now = std::chrono::steady_clock::now();
+    uint64_t generation;
+    {
+        std::lock_guard lock{mutex_};
+        if (anchor.valid && now - anchor.time < resyncInterval)
+        {
+            uint32_t elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - anchor.time).count();
+            return Result<uint32_t>{anchor.value + elapsed};
+        }
+        generation = generation_;
+    }
+
+    Result<uint32_t> result = Firebolt::Internal::get<Firebolt::JSON::Unsigned, uint32_t>(helper_, getter);
+    if (result)
+    {
+        // The platform read its counter somewhere within the round trip, the midpoint is the best estimate
+        auto received = std::chrono::steady_clock::now();
+        std::lock_guard lock{mutex_};
+        if (generation == generation_)
+        {
+            anchor.valid = true;
+            anchor.value = *result;
+            anchor.time = now + (received - now) / 2;
+        }
+    }
+    return result;
+}
+} // namespace Firebolt::Device
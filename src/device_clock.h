@@ -0,0 +1,80 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "json_decode.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <firebolt/helpers.h>
+#include <mutex>
+
+namespace Firebolt::Device
+{
+/**
+ * @brief Local extrapolation of Device.uptime and Device.timeInActiveState
+ *
+ * Each counter is sampled once and anchored to the monotonic clock (std::chrono::steady_clock,
+ * i.e. CLOCK_MONOTONIC); reads in between are computed locally. A counter is resampled once the
+ * resync interval has passed, and both are resampled on connection changes.
+ *
+ * Both counters advance whatever the app's Lifecycle state: timeInActiveState counts from the device
+ * entering the ON power state, not from the app becoming active.
+ */
+class DeviceClock
+{
+public:
+    explicit DeviceClock(Firebolt::Helpers::IHelper& helper);
+    DeviceClock(const DeviceClock&) = delete;
+    DeviceClock& operator=(const DeviceClock&) = delete;
+
+    /**
+     * @brief Sets the resync interval, zero disables extrapolation
+     */
+    void setResyncInterval(std::chrono::milliseconds interval);
+    bool enabled() const { return resyncInterval_ms_.load() > 0; }
+
+    Result<uint32_t> uptime();
+    Result<uint32_t> timeInActiveState();
+
+    /**
+     * @brief Drops both samples. Makes no calls into the helper.
+     */
+    void invalidate();
+
+private:
+    struct Anchor
+    {
+        bool valid = false;
+        uint32_t value = 0;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    Result<uint32_t> read(Anchor& anchor, Firebolt::Internal::Method getter);
+
+private:
+    Firebolt::Helpers::IHelper& helper_;
+    std::atomic<std::chrono::milliseconds::rep> resyncInterval_ms_{0};
+
+    std::mutex mutex_;
+    Anchor uptime_;
+    Anchor timeInActiveState_;
+    uint64_t generation_ = 0;
+};
+} // namespace Firebolt::Device
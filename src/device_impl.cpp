@@ -17,49 +17,63 @@
  */
 
 #include "device_impl.h"
-#include "json_types/device.h"
+
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Device
 {
 DeviceImpl::DeviceImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper),
-      subscriptionManager_(helper, this)
+      subscriptionManager_(helper, this),
+      hdr_(helper, Method::DeviceHdr, Method::DeviceOnHdrChanged),
+      chipsetId_(helper, Method::DeviceChipsetId),
+      deviceClass_(helper, Method::DeviceDeviceClass),
+      uid_(helper, Method::DeviceUid),
+      clock_(helper)
 {
 }
 
 Result<std::string> DeviceImpl::chipsetId() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Device.chipsetId");
+    return chipsetId_.get();
 }
 
 Result<DeviceClass> DeviceImpl::deviceClass() const
 {
-    return Result(helper_.get<JsonData::DeviceClassJson, DeviceClass>("Device.deviceClass"));
+    return deviceClass_.get();
 }
 
 Result<HDRFormat> DeviceImpl::hdr() const
 {
-    return Result(helper_.get<JsonData::HDRFormat, HDRFormat>("Device.hdr"));
+    return hdr_.get();
 }
 
 Result<uint32_t> DeviceImpl::timeInActiveState() const
 {
-    return helper_.get<Firebolt::JSON::Unsigned, uint32_t>("Device.timeInActiveState");
+    if (clock_.enabled())
+    {
+        return clock_.timeInActiveState();
+    }
+    return Firebolt::Internal::get<Firebolt::JSON::Unsigned, uint32_t>(helper_, Method::DeviceTimeInActiveState);
 }
 
 Result<std::string> DeviceImpl::uid() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Device.uid");
+    return uid_.get();
 }
 
 Result<uint32_t> DeviceImpl::uptime() const
 {
-    return helper_.get<Firebolt::JSON::Unsigned, uint32_t>("Device.uptime");
+    if (clock_.enabled())
+    {
+        return clock_.uptime();
+    }
+    return Firebolt::Internal::get<Firebolt::JSON::Unsigned, uint32_t>(helper_, Method::DeviceUptime);
 }
 
 Result<SubscriptionId> DeviceImpl::subscribeOnHdrChanged(std::function<void(const HDRFormat&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::HDRFormat>("Device.onHdrChanged", std::move(notification));
+    return subscriptionManager_.subscribe<JsonData::HDRFormat>(Method::DeviceOnHdrChanged, std::move(notification));
 }
 
 Result<void> DeviceImpl::unsubscribe(SubscriptionId id)
@@ -71,4 +85,19 @@ void DeviceImpl::unsubscribeAll()
 {
     subscriptionManager_.unsubscribeAll();
 }
+
+void DeviceImpl::configure(const ClientOptions& options)
+{
+    hdr_.setEnabled(options.propertyCache);
+    clock_.setResyncInterval(options.clockResyncInterval);
+}
+
+void DeviceImpl::onConnectionChanged(bool /*connected*/)
+{
+    hdr_.invalidate();
+    chipsetId_.invalidate();
+    deviceClass_.invalidate();
+    uid_.invalidate();
+    clock_.invalidate();
+}
 } // namespace Firebolt::Device
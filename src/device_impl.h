@@ -18,7 +18,12 @@
 
 #pragma once
 
+#include "cached_property.h"
+#include "device_clock.h"
+#include "firebolt/client_options.h"
 #include "firebolt/device.h"
+#include "json_decode.h"
+#include "json_types/device.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::Device
@@ -44,8 +49,20 @@ public:
     Result<void> unsubscribe(SubscriptionId id) override;
     void unsubscribeAll() override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
+
+    mutable Firebolt::Internal::CachedProperty<JsonData::HDRFormat, HDRFormat> hdr_;
+
+    // Facts that cannot change during a connection
+    mutable Firebolt::Internal::MemoizedProperty<Firebolt::JSON::String, std::string> chipsetId_;
+    mutable Firebolt::Internal::MemoizedProperty<JsonData::DeviceClassJson, DeviceClass> deviceClass_;
+    mutable Firebolt::Internal::MemoizedProperty<Firebolt::JSON::String, std::string> uid_;
+
+    mutable DeviceClock clock_;
 };
 } // namespace Firebolt::Device
@@ -18,10 +18,33 @@
 
 #include "discovery_impl.h"
 #include "json_types/common.h"
+#include "json_writer.h"
 #include <firebolt/json_types.h>
+#include <optional>
+
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Discovery
 {
+namespace
+{
+nlohmann::json watchedParameters(const std::string& entityId, std::optional<double> progress,
+                                 std::optional<bool> completed, const std::optional<std::string>& watchedOn,
+                                 std::optional<Firebolt::AgePolicy> agePolicy)
+{
+    Firebolt::Internal::JsonDomWriter parameters;
+    parameters.field("entityId", entityId);
+    parameters.field("progress", progress);
+    parameters.field("completed", completed);
+    parameters.field("watchedOn", watchedOn);
+    if (agePolicy)
+    {
+        parameters.field("agePolicy", Firebolt::JsonData::AgePolicyEnum.name(*agePolicy));
+    }
+    return parameters.finish();
+}
+} // namespace
+
 DiscoveryImpl::DiscoveryImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper)
 {
@@ -31,51 +54,77 @@ Result<bool> DiscoveryImpl::watched(const std::string& entityId, std::optional<d
                                     std::optional<bool> completed, std::optional<std::string> watchedOn,
                                     std::optional<Firebolt::AgePolicy> agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (progress)
-    {
-        parameters["progress"] = *progress;
-    }
-    if (completed)
-    {
-        parameters["completed"] = *completed;
-    }
-    if (watchedOn)
-    {
-        parameters["watchedOn"] = *watchedOn;
-    }
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Discovery.watched", parameters);
+    return deliver(Method::DiscoveryWatched, watchedParameters(entityId, progress, completed, watchedOn, agePolicy));
 }
 
 Result<bool> DiscoveryImpl::watchedV2(const std::string& entityId, std::optional<double> progress,
                                       std::optional<bool> completed, std::optional<std::string> watchedOn,
                                       std::optional<Firebolt::AgePolicy> agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (progress)
+    return deliver(Method::DiscoveryWatchedV2, watchedParameters(entityId, progress, completed, watchedOn, agePolicy));
+}
+
+DiscoveryImpl::~DiscoveryImpl()
+{
+    if (auto outbox = std::atomic_load(&outbox_))
     {
-        parameters["progress"] = *progress;
+        outbox->waitForReplay();
     }
-    if (completed)
+}
+
+void DiscoveryImpl::configure(const ClientOptions& options)
+{
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox;
+    if (!options.outboxDirectory.empty())
     {
-        parameters["completed"] = *completed;
+        outbox = Firebolt::Internal::Outbox::open(options.outboxDirectory + "/discovery.outbox", options.outboxSize);
     }
-    if (watchedOn)
+    std::atomic_store(&outbox_, std::move(outbox));
+}
+
+void DiscoveryImpl::onConnectionChanged(bool connected)
+{
+    auto outbox = std::atomic_load(&outbox_);
+    if (!connected || !outbox)
     {
-        parameters["watchedOn"] = *watchedOn;
+        connected_.store(connected);
+        return;
     }
-    if (agePolicy)
+    outbox->replay(
+        [this](const std::string& method, const nlohmann::json& parameters)
+        {
+            Result<bool> result =
+                Firebolt::Internal::get<Firebolt::JSON::Boolean, bool>(helper_, method, parameters);
+            return result ? Result<void>{Firebolt::Error::None} : Result<void>{result.error()};
+        });
+    connected_.store(true);
+}
+
+Result<bool> DiscoveryImpl::deliver(Method method, const nlohmann::json& parameters) const
+{
+    auto outbox = std::atomic_load(&outbox_);
+    if (!outbox)
     {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
+        return Firebolt::Internal::get<Firebolt::JSON::Boolean, bool>(helper_, method, parameters);
     }
-
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Discovery.watchedV2", parameters);
+    std::optional<bool> watched;
+    Result<void> result = outbox->deliver(
+        Firebolt::Internal::MethodNames[method], parameters, connected_.load(),
+        [&]
+        {
+            Result<bool> sent = Firebolt::Internal::get<Firebolt::JSON::Boolean, bool>(helper_, method, parameters);
+            if (!sent)
+            {
+                return Result<void>{sent.error()};
+            }
+            watched = *sent;
+            return Result<void>{Firebolt::Error::None};
+        });
+    if (!result)
+    {
+        return Result<bool>{result.error()};
+    }
+    // A stored call reports true, the caller must not send it again
+    return Result<bool>{watched.value_or(true)};
 }
 } // namespace Firebolt::Discovery
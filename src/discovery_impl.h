@@ -18,9 +18,14 @@
 
 #pragma once
 
+#include "firebolt/client_options.h"
 #include "firebolt/common_types.h"
 #include "firebolt/discovery.h"
+#include "json_decode.h"
+#include "outbox.h"
+#include <atomic>
 #include <firebolt/helpers.h>
+#include <memory>
 
 namespace Firebolt::Discovery
 {
@@ -31,7 +36,7 @@ public:
     DiscoveryImpl(const DiscoveryImpl&) = delete;
     DiscoveryImpl& operator=(const DiscoveryImpl&) = delete;
 
-    ~DiscoveryImpl() override = default;
+    ~DiscoveryImpl() override;
 
     Result<bool> watched(const std::string& entityId, std::optional<double> progress, std::optional<bool> completed,
                          std::optional<std::string> watchedOn,
@@ -41,7 +46,17 @@ public:
                            std::optional<std::string> watchedOn,
                            std::optional<Firebolt::AgePolicy> agePolicy) const override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
+private:
+    Result<bool> deliver(Firebolt::Internal::Method method, const nlohmann::json& parameters) const;
+
 private:
     Firebolt::Helpers::IHelper& helper_;
+
+    // Set while enabled by ClientOptions::outboxDirectory, accessed with std::atomic_load/atomic_store
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox_;
+    std::atomic<bool> connected_{true};
 };
 } // namespace Firebolt::Discovery
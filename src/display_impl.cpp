@@ -17,27 +17,36 @@
  */
 
 #include "display_impl.h"
-#include "json_types/display.h"
+
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Display
 {
 DisplayImpl::DisplayImpl(Firebolt::Helpers::IHelper& helper)
-    : helper_(helper)
+    : helper_(helper),
+      edid_(helper, Method::DisplayEdid),
+      maxResolution_(helper, Method::DisplayMaxResolution)
 {
 }
 
 Result<std::string> DisplayImpl::edid() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Display.edid");
+    return edid_.get();
 }
 
 Result<DisplaySize> DisplayImpl::maxResolution() const
 {
-    return helper_.get<JsonData::DisplaySizeJson, DisplaySize>("Display.maxResolution");
+    return maxResolution_.get();
 }
 
 Result<DisplaySize> DisplayImpl::size() const
 {
-    return helper_.get<JsonData::DisplaySizeJson, DisplaySize>("Display.size");
+    return Firebolt::Internal::get<JsonData::DisplaySizeJson, DisplaySize>(helper_, Method::DisplaySize);
+}
+
+void DisplayImpl::onConnectionChanged(bool /*connected*/)
+{
+    edid_.invalidate();
+    maxResolution_.invalidate();
 }
 } // namespace Firebolt::Display
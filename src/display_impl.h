@@ -18,8 +18,12 @@
 
 #pragma once
 
+#include "cached_property.h"
 #include "firebolt/display.h"
+#include "json_decode.h"
+#include "json_types/display.h"
 #include <firebolt/helpers.h>
+#include <firebolt/json_types.h>
 
 namespace Firebolt::Display
 {
@@ -36,8 +40,13 @@ public:
     Result<DisplaySize> maxResolution() const override;
     Result<DisplaySize> size() const override;
 
+    void onConnectionChanged(bool connected);
+
 private:
     Firebolt::Helpers::IHelper& helper_;
-    // Methods
+
+    // Facts that cannot change during a connection
+    mutable Firebolt::Internal::MemoizedProperty<Firebolt::JSON::String, std::string> edid_;
+    mutable Firebolt::Internal::MemoizedProperty<JsonData::DisplaySizeJson, DisplaySize> maxResolution_;
 };
 } // namespace Firebolt::Display
@@ -0,0 +1,488 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "event_channels.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace Firebolt::Internal
+{
+struct EventChannels::Channel
+{
+    // Newest event not yet delivered to a conflating listener, a delivery is queued while it is set
+    struct Latest
+    {
+        std::mutex mutex;
+        std::optional<nlohmann::json> payload;
+    };
+    // Last event delivered to a listener dropping repeated events
+    struct Delivered
+    {
+        std::mutex mutex;
+        std::optional<nlohmann::json> payload;
+
+        // Remembers payload if it differs from the last one
+        bool changed(const nlohmann::json& payload)
+        {
+            std::lock_guard lock{mutex};
+            if (this->payload == payload)
+            {
+                return false;
+            }
+            this->payload = payload;
+            return true;
+        }
+    };
+    struct Group
+    {
+        std::type_index decoding;
+        Dispatch dispatch;
+        std::vector<SubscriptionId> ids;
+        Listeners listeners;
+        // Set for the listeners conflating their events
+        std::vector<std::shared_ptr<Latest>> latest;
+        // Set for the listeners dropping repeated events
+        std::vector<std::shared_ptr<Delivered>> delivered;
+    };
+    // Listeners of a group receiving the same delivery
+    struct Target
+    {
+        Dispatch dispatch;
+        Listeners listeners;
+        std::vector<std::shared_ptr<Delivered>> delivered;
+    };
+
+    std::string eventName;
+    SubscriptionId platformId = 0;
+    std::shared_ptr<EventExecutor> executor;
+
+    // Guards groups, which are read on the transport's thread
+    std::mutex mutex;
+    std::vector<Group> groups;
+
+    bool empty()
+    {
+        std::lock_guard lock{mutex};
+        return groups.empty();
+    }
+
+    void add(SubscriptionId id, std::type_index decoding, Dispatch dispatch, std::shared_ptr<Callback> notification)
+    {
+        std::lock_guard lock{mutex};
+        auto group = std::find_if(groups.begin(), groups.end(), [decoding](const Group& g)
+                                  { return g.decoding == decoding; });
+        if (group == groups.end())
+        {
+            group = groups.insert(groups.end(), Group{decoding, dispatch, {}, {}, {}, {}});
+        }
+        group->ids.push_back(id);
+        group->listeners.push_back(std::move(notification));
+        group->latest.emplace_back();
+        group->delivered.emplace_back();
+    }
+
+    std::shared_ptr<Callback> remove(SubscriptionId id)
+    {
+        std::lock_guard lock{mutex};
+        for (auto group = groups.begin(); group != groups.end(); ++group)
+        {
+            auto it = std::find(group->ids.begin(), group->ids.end(), id);
+            if (it != group->ids.end())
+            {
+                auto index = it - group->ids.begin();
+                std::shared_ptr<Callback> listener = std::move(group->listeners[index]);
+                group->listeners.erase(group->listeners.begin() + index);
+                group->latest.erase(group->latest.begin() + index);
+                group->delivered.erase(group->delivered.begin() + index);
+                group->ids.erase(it);
+                if (group->ids.empty())
+                {
+                    groups.erase(group);
+                }
+                return listener;
+            }
+        }
+        return nullptr;
+    }
+
+    // Turns the per-listener state kept in slot on or off for the listener id
+    template <typename State>
+    void setPolicy(SubscriptionId id, std::vector<std::shared_ptr<State>> Group::*slot, bool enabled)
+    {
+        std::lock_guard lock{mutex};
+        for (auto& group : groups)
+        {
+            auto it = std::find(group.ids.begin(), group.ids.end(), id);
+            if (it != group.ids.end())
+            {
+                auto& state = (group.*slot)[it - group.ids.begin()];
+                if (!enabled)
+                {
+                    // A delivery already queued for the listener still takes place
+                    state.reset();
+                }
+                else if (!state)
+                {
+                    state = std::make_shared<State>();
+                }
+                return;
+            }
+        }
+    }
+
+    // Keeps the listeners of target that payload changed for, returns false if none is left
+    static bool narrow(EventExecutor& executor, Target& target, const nlohmann::json& payload)
+    {
+        if (std::none_of(target.delivered.begin(), target.delivered.end(), [](const auto& d) { return d != nullptr; }))
+        {
+            return !target.listeners.empty();
+        }
+        Listeners changed;
+        for (std::size_t i = 0; i < target.listeners.size(); ++i)
+        {
+            if (!target.delivered[i] || target.delivered[i]->changed(payload))
+            {
+                changed.push_back(target.listeners[i]);
+            }
+            else
+            {
+                executor.countDuplicate();
+            }
+        }
+        target.listeners = std::move(changed);
+        target.delivered.clear();
+        return !target.listeners.empty();
+    }
+
+    // Decodes payload once for the listeners of target it changed for, repeated events do not reach the decoder
+    static void deliver(EventExecutor& executor, const Target& target, const nlohmann::json& payload)
+    {
+        if (std::none_of(target.delivered.begin(), target.delivered.end(), [](const auto& d) { return d != nullptr; }))
+        {
+            target.dispatch(payload, target.listeners);
+            return;
+        }
+        Target changed = target;
+        if (narrow(executor, changed, payload))
+        {
+            changed.dispatch(payload, changed.listeners);
+        }
+    }
+};
+
+bool EventChannels::Callback::enter()
+{
+    std::lock_guard lock{mutex_};
+    if (cancelled_)
+    {
+        return false;
+    }
+    running_.push_back(std::this_thread::get_id());
+    return true;
+}
+
+void EventChannels::Callback::leave()
+{
+    {
+        std::lock_guard lock{mutex_};
+        running_.erase(std::find(running_.begin(), running_.end(), std::this_thread::get_id()));
+    }
+    cv_.notify_all();
+}
+
+void EventChannels::Callback::cancel()
+{
+    std::unique_lock lock{mutex_};
+    cancelled_ = true;
+    // A listener removing itself from its own notification cannot wait for it to return
+    cv_.wait(lock,
+             [this]
+             {
+                 return std::all_of(running_.begin(), running_.end(),
+                                    [](std::thread::id id) { return id == std::this_thread::get_id(); });
+             });
+}
+
+EventChannels::EventChannels(Firebolt::Helpers::IHelper& helper)
+    : helper_(helper),
+      nextId_(1)
+{
+}
+
+std::shared_ptr<EventChannels> EventChannels::of(Firebolt::Helpers::IHelper& helper)
+{
+    static std::mutex mutex;
+    static std::map<Firebolt::Helpers::IHelper*, std::weak_ptr<EventChannels>> registry;
+
+    std::lock_guard lock{mutex};
+    for (auto it = registry.begin(); it != registry.end();)
+    {
+        it = it->second.expired() ? registry.erase(it) : std::next(it);
+    }
+    std::weak_ptr<EventChannels>& entry = registry[&helper];
+    std::shared_ptr<EventChannels> channels = entry.lock();
+    if (!channels)
+    {
+        channels = std::make_shared<EventChannels>(helper);
+        entry = channels;
+    }
+    return channels;
+}
+
+Result<SubscriptionId> EventChannels::subscribe(void* owner, const std::string& eventName, std::type_index decoding,
+                                                Dispatch dispatch, std::any&& notification)
+{
+    auto listener = std::make_shared<Callback>(std::move(notification));
+    std::lock_guard subscribeLock{subscribeMutex_};
+    SubscriptionId id;
+    {
+        std::lock_guard lock{mutex_};
+        id = nextId_++;
+        auto it = channels_.find(eventName);
+        if (it != channels_.end())
+        {
+            it->second->add(id, decoding, dispatch, std::move(listener));
+            listeners_.emplace(id, Listener{it->second, owner});
+            return Result<SubscriptionId>{id};
+        }
+    }
+
+    auto channel = std::make_shared<Channel>();
+    channel->eventName = eventName;
+    channel->executor = executor_;
+    // The transport keeps its own reference, so an event still in flight never outlives the channel
+    Result<SubscriptionId> platformId = helper_.subscribe(this, eventName, std::shared_ptr<Channel>(channel), onEvent);
+    if (!platformId)
+    {
+        return platformId;
+    }
+    channel->platformId = *platformId;
+    channel->add(id, decoding, dispatch, std::move(listener));
+
+    std::lock_guard lock{mutex_};
+    channels_.emplace(eventName, channel);
+    listeners_.emplace(id, Listener{std::move(channel), owner});
+    return Result<SubscriptionId>{id};
+}
+
+std::optional<SubscriptionId> EventChannels::remove(SubscriptionId id, const Listener& listener,
+                                                    Listeners& removed)
+{
+    if (auto callback = listener.channel->remove(id))
+    {
+        removed.push_back(std::move(callback));
+    }
+    if (!listener.channel->empty())
+    {
+        return std::nullopt;
+    }
+    channels_.erase(listener.channel->eventName);
+    return listener.channel->platformId;
+}
+
+Result<void> EventChannels::unsubscribe(SubscriptionId id)
+{
+    Listeners removed;
+    Result<void> result{Firebolt::Error::None};
+    {
+        std::lock_guard subscribeLock{subscribeMutex_};
+        std::optional<SubscriptionId> platformId;
+        {
+            std::lock_guard lock{mutex_};
+            auto it = listeners_.find(id);
+            if (it == listeners_.end())
+            {
+                return Result<void>{Firebolt::Error::General};
+            }
+            platformId = remove(id, it->second, removed);
+            listeners_.erase(it);
+        }
+        if (platformId)
+        {
+            result = helper_.unsubscribe(*platformId);
+        }
+    }
+    // Without the locks, so that the notification being waited for may still subscribe and unsubscribe
+    for (const auto& callback : removed)
+    {
+        callback->cancel();
+    }
+    return result;
+}
+
+void EventChannels::unsubscribeAll(void* owner)
+{
+    Listeners removed;
+    {
+        std::lock_guard subscribeLock{subscribeMutex_};
+        std::vector<SubscriptionId> platformIds;
+        {
+            std::lock_guard lock{mutex_};
+            for (auto it = listeners_.begin(); it != listeners_.end();)
+            {
+                if (it->second.owner != owner)
+                {
+                    ++it;
+                    continue;
+                }
+                if (auto platformId = remove(it->first, it->second, removed))
+                {
+                    platformIds.push_back(*platformId);
+                }
+                it = listeners_.erase(it);
+            }
+        }
+        for (SubscriptionId platformId : platformIds)
+        {
+            helper_.unsubscribe(platformId);
+        }
+    }
+    for (const auto& callback : removed)
+    {
+        callback->cancel();
+    }
+}
+
+std::shared_ptr<EventChannels::Channel> EventChannels::channelOf(SubscriptionId id) const
+{
+    std::lock_guard lock{mutex_};
+    auto it = listeners_.find(id);
+    return it != listeners_.end() ? it->second.channel : nullptr;
+}
+
+Result<void> EventChannels::setDelivery(SubscriptionId id, EventDelivery delivery)
+{
+    std::shared_ptr<Channel> channel = channelOf(id);
+    if (!channel)
+    {
+        return Result<void>{Firebolt::Error::General};
+    }
+    channel->setPolicy(id, &Channel::Group::latest, delivery == EventDelivery::CONFLATE);
+    return Result<void>{Firebolt::Error::None};
+}
+
+Result<void> EventChannels::setDistinct(SubscriptionId id, bool distinct)
+{
+    std::shared_ptr<Channel> channel = channelOf(id);
+    if (!channel)
+    {
+        return Result<void>{Firebolt::Error::General};
+    }
+    channel->setPolicy(id, &Channel::Group::delivered, distinct);
+    return Result<void>{Firebolt::Error::None};
+}
+
+void EventChannels::configure(const ClientOptions& options)
+{
+    executor_->configure(options.eventDispatch, options.eventDispatchThreads);
+}
+
+std::size_t EventChannels::size() const
+{
+    std::lock_guard lock{mutex_};
+    return channels_.size();
+}
+
+void EventChannels::onEvent(void* notification, const nlohmann::json& payload)
+{
+    auto& channel = *std::any_cast<std::shared_ptr<Channel>>(static_cast<std::any*>(notification));
+    bool isInline = channel->executor->isInline();
+    std::vector<Channel::Target> targets;
+    std::vector<std::pair<Channel::Target, std::shared_ptr<Channel::Latest>>> conflating;
+    {
+        std::lock_guard lock{channel->mutex};
+        targets.reserve(channel->groups.size());
+        for (const auto& group : channel->groups)
+        {
+            if (isInline)
+            {
+                targets.push_back(Channel::Target{group.dispatch, group.listeners, group.delivered});
+                continue;
+            }
+            Channel::Target target{group.dispatch, {}, {}};
+            for (std::size_t i = 0; i < group.listeners.size(); ++i)
+            {
+                if (group.latest[i])
+                {
+                    conflating.emplace_back(
+                        Channel::Target{group.dispatch, {group.listeners[i]}, {group.delivered[i]}}, group.latest[i]);
+                }
+                else
+                {
+                    target.listeners.push_back(group.listeners[i]);
+                    target.delivered.push_back(group.delivered[i]);
+                }
+            }
+            if (!target.listeners.empty())
+            {
+                targets.push_back(std::move(target));
+            }
+        }
+    }
+    // Called without the lock, so listeners may subscribe and unsubscribe from their callback
+    auto deliver = [executor = channel->executor](const std::vector<Channel::Target>& targets,
+                                                  const nlohmann::json& payload)
+    {
+        for (const auto& target : targets)
+        {
+            Channel::deliver(*executor, target, payload);
+        }
+    };
+    if (isInline)
+    {
+        channel->executor->runInline([&] { deliver(targets, payload); });
+        return;
+    }
+    // Repeated events are dropped here, so that the payload is only copied for the queue once it changed
+    targets.erase(std::remove_if(targets.begin(), targets.end(), [&](Channel::Target& target)
+                                 { return !Channel::narrow(*channel->executor, target, payload); }),
+                  targets.end());
+    if (!targets.empty())
+    {
+        // Queued, so the payload is copied off the transport's buffer
+        channel->executor->post(channel.get(),
+                                [deliver, targets = std::move(targets), payload] { deliver(targets, payload); });
+    }
+    for (auto& [target, latest] : conflating)
+    {
+        {
+            std::lock_guard lock{latest->mutex};
+            bool queued = latest->payload.has_value();
+            latest->payload = payload;
+            if (queued)
+            {
+                // Picked up by the delivery already queued, in place of the event it replaces
+                channel->executor->countConflated();
+                continue;
+            }
+        }
+        channel->executor->post(channel.get(),
+                                [executor = channel->executor, target = std::move(target), latest = latest]
+                                {
+                                    nlohmann::json payload;
+                                    {
+                                        std::lock_guard lock{latest->mutex};
+                                        payload = std::move(*latest->payload);
+                                        latest->payload.reset();
+                                    }
+                                    Channel::deliver(*executor, target, payload);
+                                });
+    }
+}
+} // namespace Firebolt::Internal
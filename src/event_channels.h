@@ -0,0 +1,195 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "event_executor.h"
+#include "firebolt/client_options.h"
+#include <any>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <firebolt/helpers.h>
+#include <firebolt/types.h>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Shares one platform subscription per event between all local listeners of a helper
+ *
+ * The first listener of an event subscribes to it through the helper, later listeners only join the channel
+ * and the last one to leave unsubscribes. Listeners decoding the payload the same way form a group, so an
+ * incoming event is decoded once per group and the value handed to every listener of the group.
+ *
+ * Every listener gets an id of its own, counted by the channels. The platform's subscription ids are kept
+ * inside, so the two can never be mistaken for one another.
+ *
+ * Events are delivered through an EventExecutor, in order for each channel. Once unsubscribe() returns, the
+ * listener is not called any more, not even for events queued before. A listener conflating its events
+ * has a queued event replaced by a newer one instead of receiving both; a listener dropping repeated events
+ * is skipped, before decoding, for a payload equal to the last one it was delivered.
+ */
+class EventChannels
+{
+public:
+    /**
+     * @brief The notification of a listener, which is not called any more once the listener is removed
+     */
+    class Callback
+    {
+    public:
+        explicit Callback(std::any&& notification)
+            : notification_(std::move(notification))
+        {
+        }
+        Callback(const Callback&) = delete;
+        Callback& operator=(const Callback&) = delete;
+
+        /**
+         * @brief Calls call(notification) unless the listener was removed, which waits for the call to return
+         */
+        template <typename Call> void operator()(Call&& call)
+        {
+            if (!enter())
+            {
+                return;
+            }
+            struct Leave
+            {
+                Callback& callback;
+                ~Leave() { callback.leave(); }
+            } leave{*this};
+            call(notification_);
+        }
+
+        /**
+         * @brief Stops later calls and waits for those in progress, except for one on the calling thread
+         */
+        void cancel();
+
+    private:
+        bool enter();
+        void leave();
+
+    private:
+        std::any notification_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool cancelled_ = false;
+        // Threads running the notification
+        std::vector<std::thread::id> running_;
+    };
+
+    using Listeners = std::vector<std::shared_ptr<Callback>>;
+
+    /**
+     * @brief Decodes payload and calls every listener with the value
+     */
+    using Dispatch = void (*)(const nlohmann::json& payload, const Listeners& listeners);
+
+    explicit EventChannels(Firebolt::Helpers::IHelper& helper);
+    EventChannels(const EventChannels&) = delete;
+    EventChannels& operator=(const EventChannels&) = delete;
+
+    /**
+     * @brief The channels of helper, shared by everyone using it while any of them is alive
+     */
+    static std::shared_ptr<EventChannels> of(Firebolt::Helpers::IHelper& helper);
+
+    /**
+     * @brief Adds a listener of eventName
+     * @param decoding : Identifies how dispatch decodes the payload, listeners of the same event decoding it the
+     *                   same way share a group. A type rather than the address of dispatch, which identical code
+     *                   folding may give to different functions.
+     */
+    Result<SubscriptionId> subscribe(void* owner, const std::string& eventName, std::type_index decoding,
+                                     Dispatch dispatch, std::any&& notification);
+
+    /**
+     * @brief Removes a listener, waiting for its notification if it is running on another thread. Calling this
+     *        while holding a lock that the notification takes deadlocks; from the notification itself, it does
+     *        not wait.
+     * @return Error::General if id is not one of the channels' listeners, such as one removed already
+     */
+    Result<void> unsubscribe(SubscriptionId id);
+    /**
+     * @brief Removes every listener of owner, waiting for their running notifications like unsubscribe()
+     */
+    void unsubscribeAll(void* owner);
+
+    /**
+     * @brief Sets which events the listener id receives, applies to events arriving later
+     * @return Error::General if id is not one of the channels' listeners
+     */
+    Result<void> setDelivery(SubscriptionId id, EventDelivery delivery);
+
+    /**
+     * @brief Sets whether the listener id is skipped for events equal to the last one it was delivered
+     * @return Error::General if id is not one of the channels' listeners
+     */
+    Result<void> setDistinct(SubscriptionId id, bool distinct);
+
+    /**
+     * @return Number of platform subscriptions currently held
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Applies ClientOptions::eventDispatch and eventDispatchThreads
+     */
+    void configure(const ClientOptions& options);
+    EventDispatchStats stats() const { return executor_->stats(); }
+    int eventFd() const { return executor_->eventFd(); }
+    std::size_t dispatchPending(std::size_t maxEvents) { return executor_->dispatchPending(maxEvents); }
+
+private:
+    struct Channel;
+    struct Listener
+    {
+        std::shared_ptr<Channel> channel;
+        void* owner;
+    };
+
+    static void onEvent(void* notification, const nlohmann::json& payload);
+    // Removes the listener into removed, returns the platform subscription to drop if it was the last one
+    std::optional<SubscriptionId> remove(SubscriptionId id, const Listener& listener, Listeners& removed);
+    std::shared_ptr<Channel> channelOf(SubscriptionId id) const;
+
+private:
+    Firebolt::Helpers::IHelper& helper_;
+    // Shared with the channels, which may outlive this registry while the transport holds them
+    const std::shared_ptr<EventExecutor> executor_ = EventExecutor::create();
+
+    // Held while calling into the helper, so a channel is subscribed and dropped only once
+    std::mutex subscribeMutex_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Channel>> channels_;
+    std::unordered_map<SubscriptionId, Listener> listeners_;
+    SubscriptionId nextId_;
+};
+} // namespace Firebolt::Internal
@@ -0,0 +1,305 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "event_executor.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <utility>
+
+namespace Firebolt::Internal
+{
+namespace
+{
+void storeMax(std::atomic<int64_t>& maximum, int64_t value)
+{
+    int64_t current = maximum.load();
+    while (value > current && !maximum.compare_exchange_weak(current, value))
+    {
+    }
+}
+
+int64_t microseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+} // namespace
+
+std::shared_ptr<EventExecutor> EventExecutor::create()
+{
+    return std::shared_ptr<EventExecutor>(new EventExecutor(),
+                                          [](EventExecutor* executor)
+                                          {
+                                              if (executor->isOwnThread())
+                                              {
+                                                  // Joins the thread this runs on once the delivery returned
+                                                  std::thread([executor] { delete executor; }).detach();
+                                              }
+                                              else
+                                              {
+                                                  delete executor;
+                                              }
+                                          });
+}
+
+EventExecutor::~EventExecutor()
+{
+    assert(!isOwnThread());
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+        strands_.clear();
+        ready_.clear();
+        pending_.clear();
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    if (eventFd_.load() >= 0)
+    {
+        ::close(eventFd_.load());
+    }
+}
+
+void EventExecutor::configure(EventDispatch mode, std::size_t threads)
+{
+    std::unique_lock lock{mutex_};
+    maxThreads_ = mode == EventDispatch::POOL ? std::max<std::size_t>(threads, 1) : 1;
+    // Idle threads above the new limit stop at once, busy ones after their delivery
+    bool wake = running_ > maxThreads_;
+    if (mode == EventDispatch::MAIN_LOOP && eventFd_.load() < 0)
+    {
+        // Kept open from then on, so the application can add it to its loop once
+        eventFd_.store(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+    }
+    if (mode == EventDispatch::MAIN_LOOP && eventFd_.load() < 0)
+    {
+        // Nothing would wake the application up, a dispatch thread delivers the events instead
+        mode = EventDispatch::THREAD;
+    }
+    mode_.store(mode);
+    if (mode != EventDispatch::MAIN_LOOP && !pending_.empty())
+    {
+        // Nobody may call dispatchPending() any more, the deliveries waiting for it run on the threads
+        uint64_t count = 0;
+        (void)!::read(eventFd_.load(), &count, sizeof(count));
+        for (auto& delivery : pending_)
+        {
+            wake = schedule(std::move(delivery)) || wake;
+        }
+        pending_.clear();
+    }
+    lock.unlock();
+    if (wake)
+    {
+        cv_.notify_all();
+    }
+}
+
+void EventExecutor::runInline(std::function<void()> delivery)
+{
+    Delivery item{std::move(delivery), std::chrono::steady_clock::now(), nullptr, 0};
+    execute(item);
+}
+
+void EventExecutor::post(const void* key, std::function<void()> delivery)
+{
+    Delivery item{std::move(delivery), std::chrono::steady_clock::now(), key, 0};
+    {
+        std::lock_guard lock{mutex_};
+        if (stopping_)
+        {
+            return;
+        }
+        maxQueueDepth_ = std::max(maxQueueDepth_, ++queueDepth_);
+        if (mode_.load() == EventDispatch::MAIN_LOOP)
+        {
+            pending_.push_back(std::move(item));
+            if (pending_.size() == 1)
+            {
+                uint64_t one = 1;
+                (void)!::write(eventFd_.load(), &one, sizeof(one));
+            }
+            return;
+        }
+        // Switched to inline meanwhile, the delivery is queued all the same
+        if (!schedule(std::move(item)))
+        {
+            return;
+        }
+    }
+    cv_.notify_one();
+}
+
+bool EventExecutor::schedule(Delivery&& delivery)
+{
+    const void* key = delivery.key;
+    delivery.sequence = sequence_++;
+    Strand& strand = strands_[key];
+    strand.deliveries.push_back(std::move(delivery));
+    if (strand.scheduled)
+    {
+        return false;
+    }
+    strand.scheduled = true;
+    ready_.push_back(key);
+    if (idle_ < ready_.size() && running_ < maxThreads_)
+    {
+        joinRetired();
+        threads_.emplace_back([this] { run(); });
+        ++running_;
+    }
+    return true;
+}
+
+void EventExecutor::joinRetired()
+{
+    for (const auto& id : retired_)
+    {
+        auto thread = std::find_if(threads_.begin(), threads_.end(),
+                                   [&id](const std::thread& candidate) { return candidate.get_id() == id; });
+        // Returns without taking the lock once retired, so joining under it cannot deadlock
+        thread->join();
+        threads_.erase(thread);
+    }
+    retired_.clear();
+}
+
+std::size_t EventExecutor::dispatchPending(std::size_t maxEvents)
+{
+    std::size_t dispatched = 0;
+    std::unique_lock lock{mutex_};
+    while (dispatched < maxEvents && !pending_.empty())
+    {
+        Delivery delivery = std::move(pending_.front());
+        pending_.pop_front();
+        --queueDepth_;
+        if (pending_.empty())
+        {
+            // Readable again with the next post(), which writes under the same lock
+            uint64_t count = 0;
+            (void)!::read(eventFd_.load(), &count, sizeof(count));
+        }
+        lock.unlock();
+        execute(delivery);
+        // The delivery holds a reference to this, but never the last one: dispatchPending() is reached through
+        // EventChannels, which owns this for as long as it lives
+        delivery.run = nullptr;
+        ++dispatched;
+        lock.lock();
+    }
+    return dispatched;
+}
+
+EventDispatchStats EventExecutor::stats() const
+{
+    EventDispatchStats stats;
+    {
+        std::lock_guard lock{mutex_};
+        stats.queueDepth = queueDepth_;
+        stats.maxQueueDepth = maxQueueDepth_;
+    }
+    stats.delivered = delivered_.load();
+    stats.conflated = conflated_.load();
+    stats.duplicates = duplicates_.load();
+    stats.totalCallbackTime = std::chrono::microseconds(totalCallbackTime_us_.load());
+    stats.maxCallbackTime = std::chrono::microseconds(maxCallbackTime_us_.load());
+    stats.maxQueueDelay = std::chrono::microseconds(maxQueueDelay_us_.load());
+    return stats;
+}
+
+void EventExecutor::execute(Delivery& delivery)
+{
+    auto started = std::chrono::steady_clock::now();
+    delivery.run();
+    int64_t callbackTime = microseconds(std::chrono::steady_clock::now() - started);
+    delivered_.fetch_add(1);
+    totalCallbackTime_us_.fetch_add(callbackTime);
+    storeMax(maxCallbackTime_us_, callbackTime);
+    storeMax(maxQueueDelay_us_, microseconds(started - delivery.posted));
+}
+
+bool EventExecutor::isOwnThread() const
+{
+    std::lock_guard lock{mutex_};
+    return std::any_of(threads_.begin(), threads_.end(),
+                       [](const std::thread& thread) { return thread.get_id() == std::this_thread::get_id(); });
+}
+
+void EventExecutor::run()
+{
+    std::unique_lock lock{mutex_};
+    while (true)
+    {
+        ++idle_;
+        cv_.wait(lock, [this] { return stopping_ || running_ > maxThreads_ || !ready_.empty(); });
+        --idle_;
+        if (stopping_)
+        {
+            return;
+        }
+        if (running_ > maxThreads_)
+        {
+            // Holds no strand here, the remaining threads take over the ready ones
+            --running_;
+            retired_.push_back(std::this_thread::get_id());
+            return;
+        }
+        auto next = ready_.begin();
+        if (mode_.load() != EventDispatch::POOL)
+        {
+            // A single thread takes the delivery that arrived first, so that all of them run in arrival order
+            next = std::min_element(ready_.begin(), ready_.end(),
+                                    [this](const void* left, const void* right)
+                                    {
+                                        return strands_[left].deliveries.front().sequence <
+                                               strands_[right].deliveries.front().sequence;
+                                    });
+        }
+        const void* key = *next;
+        ready_.erase(next);
+        Delivery delivery = std::move(strands_[key].deliveries.front());
+        strands_[key].deliveries.pop_front();
+        lock.unlock();
+        execute(delivery);
+        // Released without the lock. If it held the last reference to this, the deleter from create() deletes this
+        // on another thread, and the destructor joins this thread first, so locking again below is still safe
+        delivery.run = nullptr;
+        lock.lock();
+        --queueDepth_;
+        // The strand stays scheduled while it has deliveries, so no other thread runs them out of order
+        auto strand = strands_.find(key);
+        if (strand == strands_.end())
+        {
+            continue;
+        }
+        if (strand->second.deliveries.empty())
+        {
+            strands_.erase(strand);
+        }
+        else
+        {
+            ready_.push_back(key);
+        }
+    }
+}
+} // namespace Firebolt::Internal
@@ -0,0 +1,150 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "firebolt/client_options.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Runs event deliveries inline, on a dedicated thread, on a pool of threads or from the application's loop
+ *
+ * Deliveries posted with the same key run one at a time in the order they were posted, in every mode and across
+ * mode changes. With one thread all deliveries run in that order; in POOL mode those of different keys run
+ * concurrently. Threads are started on demand; when the mode allows fewer threads than are running, the extra
+ * ones stop after their current delivery. In MAIN_LOOP mode the
+ * deliveries wait until dispatchPending() runs them, an eventfd is readable for as long as any are waiting.
+ * The mode can be changed at any time and applies to later deliveries, the ones already queued still run;
+ * those waiting for dispatchPending() when switching away from MAIN_LOOP move to the threads.
+ * Deliveries still queued on destruction are dropped. The destructor joins the threads, so it must not run on
+ * one of them; shared ownership through create() takes care of that.
+ */
+class EventExecutor
+{
+public:
+    EventExecutor() = default;
+    EventExecutor(const EventExecutor&) = delete;
+    EventExecutor& operator=(const EventExecutor&) = delete;
+    ~EventExecutor();
+
+    /**
+     * @brief An executor that, when its last reference is released on one of its threads, such as by a delivery,
+     *        is destroyed on a thread of its own instead
+     */
+    static std::shared_ptr<EventExecutor> create();
+
+    void configure(EventDispatch mode, std::size_t threads);
+
+    /**
+     * @brief Whether deliveries are to be run inline with runInline() instead of queued with post()
+     */
+    bool isInline() const { return mode_.load() == EventDispatch::INLINE; }
+
+    void runInline(std::function<void()> delivery);
+    void post(const void* key, std::function<void()> delivery);
+
+    /**
+     * @return The eventfd that is readable while deliveries wait for dispatchPending(), -1 before MAIN_LOOP
+     *         mode was first configured or if it could not be created
+     */
+    int eventFd() const { return eventFd_.load(); }
+
+    /**
+     * @brief Runs up to maxEvents deliveries waiting for the application's loop, on the calling thread
+     * @return Number of deliveries run
+     */
+    std::size_t dispatchPending(std::size_t maxEvents);
+
+    /**
+     * @brief Counts an event replaced by a newer one before its delivery
+     */
+    void countConflated() { conflated_.fetch_add(1); }
+
+    /**
+     * @brief Counts an event dropped as equal to the last one delivered
+     */
+    void countDuplicate() { duplicates_.fetch_add(1); }
+
+    EventDispatchStats stats() const;
+
+private:
+    struct Delivery
+    {
+        std::function<void()> run;
+        std::chrono::steady_clock::time_point posted;
+        const void* key;
+        // Order of arrival, set once queued for the threads
+        uint64_t sequence;
+    };
+    struct Strand
+    {
+        std::deque<Delivery> deliveries;
+        bool scheduled = false;
+    };
+
+    void run();
+    // Queues delivery for the threads, returns whether one needs waking up
+    bool schedule(Delivery&& delivery);
+    // Joins the threads that stopped as more were running than maxThreads_
+    void joinRetired();
+    void execute(Delivery& delivery);
+    bool isOwnThread() const;
+
+private:
+    std::atomic<EventDispatch> mode_{EventDispatch::INLINE};
+    std::atomic<int> eventFd_{-1};
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<const void*, Strand> strands_;
+    // Strands with deliveries and no thread running them, in the order they became ready
+    std::deque<const void*> ready_;
+    uint64_t sequence_ = 0;
+    std::vector<std::thread> threads_;
+    // Threads of threads_ that stopped and are yet to be joined
+    std::vector<std::thread::id> retired_;
+    std::size_t running_ = 0;
+    std::size_t maxThreads_ = 1;
+    std::size_t idle_ = 0;
+    // Deliveries waiting for dispatchPending()
+    std::deque<Delivery> pending_;
+    bool stopping_ = false;
+
+    std::size_t queueDepth_ = 0;
+    std::size_t maxQueueDepth_ = 0;
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> conflated_{0};
+    std::atomic<uint64_t> duplicates_{0};
+    std::atomic<int64_t> totalCallbackTime_us_{0};
+    std::atomic<int64_t> maxCallbackTime_us_{0};
+    std::atomic<int64_t> maxQueueDelay_us_{0};
+};
+} // namespace Firebolt::Internal
@@ -0,0 +1,186 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "executor.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Firebolt::Internal
+{
+struct Executor::State
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> queue;
+    std::vector<std::thread> threads;
+    std::size_t maxThreads;
+    std::size_t idle = 0;
+    bool stopping = false;
+};
+
+Executor::Executor(std::size_t maxThreads)
+    : state_(std::make_shared<State>())
+{
+    state_->maxThreads = std::max<std::size_t>(maxThreads, 1);
+}
+
+Executor::~Executor()
+{
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard lock{state_->mutex};
+        state_->stopping = true;
+        state_->queue.clear();
+        threads.swap(state_->threads);
+    }
+    state_->cv.notify_all();
+    for (auto& thread : threads)
+    {
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            // Destroyed from one of its tasks: the worker holds its own reference to the state and
+            // stops once the task returns, without touching this object
+            thread.detach();
+        }
+        else
+        {
+            thread.join();
+        }
+    }
+}
+
+void Executor::setMaxThreads(std::size_t maxThreads)
+{
+    std::lock_guard lock{state_->mutex};
+    state_->maxThreads = std::max<std::size_t>(maxThreads, 1);
+}
+
+void Executor::post(std::function<void()> task)
+{
+    {
+        std::lock_guard lock{state_->mutex};
+        if (state_->stopping)
+        {
+            return;
+        }
+        state_->queue.push_back(std::move(task));
+        if (state_->idle < state_->queue.size() && state_->threads.size() < state_->maxThreads)
+        {
+            state_->threads.emplace_back([state = state_] { run(state); });
+        }
+    }
+    state_->cv.notify_one();
+}
+
+void Executor::runAll(std::vector<std::function<void()>>& tasks)
+{
+    if (tasks.size() <= 1)
+    {
+        for (auto& task : tasks)
+        {
+            task();
+        }
+        return;
+    }
+
+    struct Batch
+    {
+        std::vector<std::atomic<bool>> claimed;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t remaining;
+        std::exception_ptr exception;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->claimed = std::vector<std::atomic<bool>>(tasks.size());
+    batch->remaining = tasks.size();
+
+    auto runTask = [batch, &tasks](std::size_t index)
+    {
+        if (batch->claimed[index].exchange(true))
+        {
+            return;
+        }
+#if __cpp_exceptions
+        // Kept for the caller, which must not leave while other tasks still use tasks
+        std::exception_ptr exception;
+        try
+        {
+            tasks[index]();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+        std::lock_guard lock{batch->mutex};
+        if (exception && !batch->exception)
+        {
+            batch->exception = exception;
+        }
+#else
+        tasks[index]();
+        std::lock_guard lock{batch->mutex};
+#endif
+        if (--batch->remaining == 0)
+        {
+            batch->cv.notify_all();
+        }
+    };
+
+    for (std::size_t i = 1; i < tasks.size(); ++i)
+    {
+        post([runTask, i] { runTask(i); });
+    }
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+    {
+        runTask(i);
+    }
+
+    std::unique_lock lock{batch->mutex};
+    batch->cv.wait(lock, [&batch] { return batch->remaining == 0; });
+    if (batch->exception)
+    {
+        std::rethrow_exception(batch->exception);
+    }
+}
+
+void Executor::run(const std::shared_ptr<State>& state)
+{
+    std::unique_lock lock{state->mutex};
+    while (true)
+    {
+        ++state->idle;
+        state->cv.wait(lock, [&state] { return state->stopping || !state->queue.empty(); });
+        --state->idle;
+        if (state->stopping)
+        {
+            return;
+        }
+        auto task = std::move(state->queue.front());
+        state->queue.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+} // namespace Firebolt::Internal
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Bounded pool of worker threads running the client's asynchronous requests
+ *
+ * Workers are started on demand, up to the configured maximum, and then kept for later requests.
+ * Since every IHelper call blocks until its response arrives, each request occupies a worker for its whole
+ * round trip and the maximum is also the number of asynchronous requests that can be in flight at once.
+ * Tasks still queued on destruction are dropped. A task may destroy the executor running it: the worker
+ * shares the executor's state and only leaves it once the task returned.
+ */
+class Executor
+{
+public:
+    explicit Executor(std::size_t maxThreads);
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+    ~Executor();
+
+    /**
+     * @brief Sets the maximum number of workers, at least one. Running workers above it are not stopped.
+     */
+    void setMaxThreads(std::size_t maxThreads);
+
+    void post(std::function<void()> task);
+
+    /**
+     * @brief Runs the tasks concurrently and returns when all of them completed.
+     *        The calling thread runs every task no worker has picked up yet, so this neither waits for
+     *        a free worker nor deadlocks when called from a worker. At most one task per worker plus the
+     *        caller's run at once, more tasks than that run one after the other. If tasks throw, the
+     *        others still run and the first exception is rethrown once all of them completed.
+     */
+    void runAll(std::vector<std::function<void()>>& tasks);
+
+private:
+    struct State;
+    static void run(const std::shared_ptr<State>& state);
+
+private:
+    // Shared with the workers, so one destroying the executor from a task can still return to its loop
+    const std::shared_ptr<State> state_;
+};
+} // namespace Firebolt::Internal
@@ -23,6 +23,8 @@
 #include "device_impl.h"
 #include "discovery_impl.h"
 #include "display_impl.h"
+#include "event_channels.h"
+#include "executor.h"
 #include "firebolt/client_version.h"
 #include "lifecycle_impl.h"
 #include "localization_impl.h"
@@ -31,30 +33,76 @@
 #include "presentation_impl.h"
 #include "stats_impl.h"
 #include "texttospeech_impl.h"
+#include <atomic>
 #include <firebolt/gateway.h>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
 
 namespace Firebolt
 {
-class FireboltAccessorImpl : public IFireboltAccessor
+template <typename Impl, typename = void> struct IsConfigurable : std::false_type
+{
+};
+template <typename Impl>
+struct IsConfigurable<Impl, std::void_t<decltype(std::declval<Impl&>().configure(std::declval<const ClientOptions&>()))>>
+    : std::true_type
+{
+};
+
+template <typename Impl, typename = void> struct IsConnectionAware : std::false_type
+{
+};
+template <typename Impl>
+struct IsConnectionAware<Impl, std::void_t<decltype(std::declval<Impl&>().onConnectionChanged(std::declval<bool>()))>>
+    : std::true_type
+{
+};
+
+/**
+ * @brief Holds an interface implementation that is constructed on first use
+ *
+ * Construction is guarded by std::call_once, so concurrent first calls are safe and
+ * only one instance is ever created.
+ */
+template <typename Impl> class LazyInterface
 {
 public:
-    FireboltAccessorImpl()
-        : accessibility_(Firebolt::Helpers::GetHelperInstance()),
-          advertising_(Firebolt::Helpers::GetHelperInstance()),
-          actions_(Firebolt::Helpers::GetHelperInstance()),
-          device_(Firebolt::Helpers::GetHelperInstance()),
-          discovery_(Firebolt::Helpers::GetHelperInstance()),
-          display_(Firebolt::Helpers::GetHelperInstance()),
-          lifecycle_(Firebolt::Helpers::GetHelperInstance()),
-          localization_(Firebolt::Helpers::GetHelperInstance()),
-          metrics_(Firebolt::Helpers::GetHelperInstance()),
-          network_(Firebolt::Helpers::GetHelperInstance()),
-          presentation_(Firebolt::Helpers::GetHelperInstance()),
-          stats_(Firebolt::Helpers::GetHelperInstance()),
-          textToSpeech_(Firebolt::Helpers::GetHelperInstance())
+    LazyInterface() = default;
+    LazyInterface(const LazyInterface&) = delete;
+    LazyInterface& operator=(const LazyInterface&) = delete;
+
+    template <typename OnCreate> Impl& get(OnCreate&& onCreate)
     {
+        std::call_once(once_,
+                       [this, &onCreate]
+                       {
+                           impl_ = std::make_unique<Impl>(Firebolt::Helpers::GetHelperInstance());
+                           onCreate(*impl_);
+                           created_.store(true, std::memory_order_release);
+                       });
+        return *impl_;
     }
 
+    /**
+     * @brief Returns the implementation only if it has already been constructed
+     *
+     * @return Pointer to the implementation or nullptr
+     */
+    Impl* getIfCreated() { return created_.load(std::memory_order_acquire) ? impl_.get() : nullptr; }
+
+private:
+    std::once_flag once_;
+    std::atomic<bool> created_{false};
+    std::unique_ptr<Impl> impl_;
+};
+
+class FireboltAccessorImpl : public IFireboltAccessor, public IFireboltAccessorExtensions
+{
+public:
+    FireboltAccessorImpl() = default;
+
     FireboltAccessorImpl(const FireboltAccessorImpl&) = delete;
     FireboltAccessorImpl& operator=(const FireboltAccessorImpl&) = delete;
 
@@ -62,7 +110,34 @@ public:
 
     Firebolt::Error Connect(const Firebolt::Config& config, OnConnectionChanged listener) override
     {
-        auto result = Firebolt::Transport::GetGatewayInstance().connect(config, listener);
+        return Connect(config, ClientOptions{}, std::move(listener));
+    }
+
+    Firebolt::Error Connect(const Firebolt::Config& config, const ClientOptions& options,
+                            OnConnectionChanged listener) override
+    {
+        if (options.asyncWorkers == 0)
+        {
+            FIREBOLT_LOG_ERROR("Client", "ClientOptions::asyncWorkers must be at least 1");
+            return Firebolt::Error::InvalidParams;
+        }
+        {
+            std::lock_guard lock{optionsMutex_};
+            options_ = options;
+            executor_.setMaxThreads(options.asyncWorkers);
+            eventChannels_->configure(options);
+            forEachInterface([this](auto& lazy) { configure(lazy); });
+        }
+        auto result = Firebolt::Transport::GetGatewayInstance().connect(
+            config,
+            [this, listener = std::move(listener)](const bool connected, const Firebolt::Error error)
+            {
+                notifyConnectionChanged(connected);
+                if (listener)
+                {
+                    listener(connected, error);
+                }
+            });
         FIREBOLT_LOG_NOTICE("Client", "Version: %s", Version::String);
         return result;
     }
@@ -70,54 +145,165 @@ public:
     Firebolt::Error Disconnect() override
     {
         unsubscribeAll();
+        notifyConnectionChanged(false);
         return Firebolt::Transport::GetGatewayInstance().disconnect();
     }
 
-    Accessibility::IAccessibility& AccessibilityInterface() override { return accessibility_; }
-    Advertising::IAdvertising& AdvertisingInterface() override { return advertising_; }
-    Device::IDevice& DeviceInterface() override { return device_; }
-    Discovery::IDiscovery& DiscoveryInterface() override { return discovery_; }
-    Display::IDisplay& DisplayInterface() override { return display_; }
-    Lifecycle::ILifecycle& LifecycleInterface() override { return lifecycle_; }
-    Localization::ILocalization& LocalizationInterface() override { return localization_; }
-    Metrics::IMetrics& MetricsInterface() override { return metrics_; }
-    Network::INetwork& NetworkInterface() override { return network_; }
-    Presentation::IPresentation& PresentationInterface() override { return presentation_; }
-    Stats::IStats& StatsInterface() override { return stats_; }
-    TextToSpeech::ITextToSpeech& TextToSpeechInterface() override { return textToSpeech_; }
-    Actions::IActions& ActionsInterface() override { return actions_; }
+    Accessibility::IAccessibility& AccessibilityInterface() override { return get(accessibility_); }
+    Advertising::IAdvertising& AdvertisingInterface() override { return get(advertising_); }
+    Device::IDevice& DeviceInterface() override { return get(device_); }
+    Discovery::IDiscovery& DiscoveryInterface() override { return get(discovery_); }
+    Display::IDisplay& DisplayInterface() override { return get(display_); }
+    Lifecycle::ILifecycle& LifecycleInterface() override { return get(lifecycle_); }
+    Localization::ILocalization& LocalizationInterface() override { return get(localization_); }
+    Metrics::IMetrics& MetricsInterface() override { return get(metrics_); }
+    Network::INetwork& NetworkInterface() override { return get(network_); }
+    Presentation::IPresentation& PresentationInterface() override { return get(presentation_); }
+    Stats::IStats& StatsInterface() override { return get(stats_); }
+    TextToSpeech::ITextToSpeech& TextToSpeechInterface() override { return get(textToSpeech_); }
+    Actions::IActions& ActionsInterface() override { return get(actions_); }
+
+    EventDispatchStats EventDispatchStatistics() const override { return eventChannels_->stats(); }
+    int EventFd() const override { return eventChannels_->eventFd(); }
+    std::size_t DispatchPending(std::size_t maxEvents) override { return eventChannels_->dispatchPending(maxEvents); }
+    Result<void> SetEventDelivery(SubscriptionId id, EventDelivery delivery) override
+    {
+        return eventChannels_->setDelivery(id, delivery);
+    }
+    Result<void> SetDistinctUntilChanged(SubscriptionId id, bool distinct) override
+    {
+        return eventChannels_->setDistinct(id, distinct);
+    }
+
+protected:
+    void Post(std::function<void()> task) override { executor_.post(std::move(task)); }
+    void RunBatch(std::vector<std::function<void()>>& tasks) override { executor_.runAll(tasks); }
 
 private:
+    template <typename Impl> Impl& get(LazyInterface<Impl>& lazy)
+    {
+        if (Impl* impl = lazy.getIfCreated())
+        {
+            return *impl;
+        }
+        // Creation is serialized with Connect(), so a new implementation never misses the current options
+        std::lock_guard lock{optionsMutex_};
+        return lazy.get(
+            [this](Impl& impl)
+            {
+                if constexpr (IsConfigurable<Impl>::value)
+                {
+                    impl.configure(options_);
+                }
+            });
+    }
+
+    template <typename Impl> void configure(LazyInterface<Impl>& lazy)
+    {
+        if constexpr (IsConfigurable<Impl>::value)
+        {
+            if (Impl* impl = lazy.getIfCreated())
+            {
+                impl->configure(options_);
+            }
+        }
+    }
+
+    void notifyConnectionChanged(bool connected)
+    {
+        forEachInterface(
+            [connected](auto& lazy)
+            {
+                using Impl = std::remove_pointer_t<decltype(lazy.getIfCreated())>;
+                if constexpr (IsConnectionAware<Impl>::value)
+                {
+                    if (Impl* impl = lazy.getIfCreated())
+                    {
+                        impl->onConnectionChanged(connected);
+                    }
+                }
+            });
+    }
+
+    template <typename Function> void forEachInterface(Function&& function)
+    {
+        function(accessibility_);
+        function(advertising_);
+        function(actions_);
+        function(device_);
+        function(discovery_);
+        function(display_);
+        function(lifecycle_);
+        function(localization_);
+        function(metrics_);
+        function(network_);
+        function(presentation_);
+        function(stats_);
+        function(textToSpeech_);
+    }
+
     void unsubscribeAll()
     {
-        accessibility_.unsubscribeAll();
-        actions_.unsubscribeAll();
-        lifecycle_.unsubscribeAll();
-        localization_.unsubscribeAll();
-        network_.unsubscribeAll();
-        presentation_.unsubscribeAll();
-        textToSpeech_.unsubscribeAll();
+        unsubscribeAll(accessibility_);
+        unsubscribeAll(actions_);
+        unsubscribeAll(device_);
+        unsubscribeAll(lifecycle_);
+        unsubscribeAll(localization_);
+        unsubscribeAll(network_);
+        unsubscribeAll(presentation_);
+        unsubscribeAll(textToSpeech_);
+    }
+
+    template <typename Impl> static void unsubscribeAll(LazyInterface<Impl>& lazy)
+    {
+        if (Impl* impl = lazy.getIfCreated())
+        {
+            impl->unsubscribeAll();
+        }
     }
 
 private:
-    Accessibility::AccessibilityImpl accessibility_;
-    Advertising::AdvertisingImpl advertising_;
-    Actions::ActionsImpl actions_;
-    Device::DeviceImpl device_;
-    Discovery::DiscoveryImpl discovery_;
-    Display::DisplayImpl display_;
-    Lifecycle::LifecycleImpl lifecycle_;
-    Localization::LocalizationImpl localization_;
-    Metrics::MetricsImpl metrics_;
-    Network::NetworkImpl network_;
-    Presentation::PresentationImpl presentation_;
-    Stats::StatsImpl stats_;
-    TextToSpeech::TextToSpeechImpl textToSpeech_;
+    LazyInterface<Accessibility::AccessibilityImpl> accessibility_;
+    LazyInterface<Advertising::AdvertisingImpl> advertising_;
+    LazyInterface<Actions::ActionsImpl> actions_;
+    LazyInterface<Device::DeviceImpl> device_;
+    LazyInterface<Discovery::DiscoveryImpl> discovery_;
+    LazyInterface<Display::DisplayImpl> display_;
+    LazyInterface<Lifecycle::LifecycleImpl> lifecycle_;
+    LazyInterface<Localization::LocalizationImpl> localization_;
+    LazyInterface<Metrics::MetricsImpl> metrics_;
+    LazyInterface<Network::NetworkImpl> network_;
+    LazyInterface<Presentation::PresentationImpl> presentation_;
+    LazyInterface<Stats::StatsImpl> stats_;
+    LazyInterface<TextToSpeech::TextToSpeechImpl> textToSpeech_;
+
+    std::mutex optionsMutex_;
+    ClientOptions options_;
+
+    // Keeps the event channels, and with them the dispatch configuration, while no interface has subscribed
+    const std::shared_ptr<Internal::EventChannels> eventChannels_ =
+        Internal::EventChannels::of(Firebolt::Helpers::GetHelperInstance());
+
+    // Declared last so it is destroyed first, no task may outlive the interfaces
+    Internal::Executor executor_{ClientOptions{}.asyncWorkers};
 };
 
-/* static */ IFireboltAccessor& IFireboltAccessor::Instance()
+namespace
+{
+FireboltAccessorImpl& accessorImpl()
 {
     static FireboltAccessorImpl impl;
     return impl;
 }
+} // namespace
+
+/* static */ IFireboltAccessor& IFireboltAccessor::Instance()
+{
+    return accessorImpl();
+}
+
+/* static */ IFireboltAccessorExtensions& IFireboltAccessorExtensions::Instance()
+{
+    return accessorImpl();
+}
 } // namespace Firebolt
@@ -0,0 +1,239 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "event_channels.h"
+#include "json_types/json_struct.h"
+#include "methods.h"
+#include <any>
+#include <cstddef>
+#include <firebolt/helpers.h>
+#include <firebolt/json_types.h>
+#include <functional>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Turns a JSON value into the public type of JsonType, reporting a mismatch as Error::InvalidParams
+ *
+ * JsonStruct and JsonEnum types, primitives and arrays of them are decoded straight into the value that is handed
+ * to the caller, without throwing. Any other JsonType goes through fromJson(), which reports a mismatch by throwing
+ * or, without exceptions, through decodeFailed(), and then moves the value out with take() if JsonType has it, or
+ * copies it with value().
+ */
+template <typename JsonType, typename = void> struct HasTake : std::false_type
+{
+};
+template <typename JsonType>
+struct HasTake<JsonType, std::void_t<decltype(std::declval<JsonType&&>().take())>> : std::true_type
+{
+};
+
+template <typename JsonType, typename = void> struct Decoder
+{
+    using Value = decltype(std::declval<const JsonType&>().value());
+
+    static Result<Value> decode(const nlohmann::json& json)
+    {
+        JsonType jsonType;
+        if (!Firebolt::Internal::fromJson(jsonType, json))
+        {
+            return Result<Value>{Error::InvalidParams};
+        }
+        if constexpr (HasTake<JsonType>::value)
+        {
+            return Result<Value>{std::move(jsonType).take()};
+        }
+        else
+        {
+            return Result<Value>{jsonType.value()};
+        }
+    }
+};
+
+template <typename JsonType>
+struct Decoder<JsonType, std::enable_if_t<std::is_same_v<decltype(JsonType::decode(
+                                                             std::declval<const nlohmann::json&>(),
+                                                             std::declval<typename JsonType::ValueType&>())),
+                                                         bool>>>
+{
+    using Value = typename JsonType::ValueType;
+
+    static Result<Value> decode(const nlohmann::json& json)
+    {
+        Value value{};
+        if (!JsonType::decode(json, value))
+        {
+            return Result<Value>{Error::InvalidParams};
+        }
+        return Result<Value>{std::move(value)};
+    }
+};
+
+template <typename T> struct Decoder<Firebolt::JSON::NL_Json_Primitive<T>>
+{
+    using Value = T;
+
+    static Result<Value> decode(const nlohmann::json& json)
+    {
+        Value value{};
+        if (!readJson(json, value))
+        {
+            return Result<Value>{Error::InvalidParams};
+        }
+        return Result<Value>{std::move(value)};
+    }
+};
+
+template <typename JsonType, typename T> struct Decoder<Firebolt::JSON::NL_Json_Array<JsonType, T>>
+{
+    using Value = std::vector<T>;
+
+    static Result<Value> decode(const nlohmann::json& json)
+    {
+        if (!json.is_array())
+        {
+            return Result<Value>{Error::InvalidParams};
+        }
+        Value value;
+        value.reserve(json.size());
+        for (const auto& element : json)
+        {
+            auto item = Decoder<JsonType>::decode(element);
+            if (!item)
+            {
+                return Result<Value>{item.error()};
+            }
+            value.push_back(std::move(*item));
+        }
+        return Result<Value>{std::move(value)};
+    }
+};
+
+/**
+ * @brief Same as IHelper::get<>(), but decodes the response with Decoder
+ */
+template <typename JsonType, typename PropertyType = typename Decoder<JsonType>::Value>
+Result<PropertyType> get(Firebolt::Helpers::IHelper& helper, const std::string& methodName,
+                         const nlohmann::json& parameters = nlohmann::json({}))
+{
+    auto result = helper.getJson(methodName, parameters);
+    if (!result)
+    {
+        return Result<PropertyType>{result.error()};
+    }
+    if constexpr (std::is_same_v<PropertyType, typename Decoder<JsonType>::Value>)
+    {
+        return Decoder<JsonType>::decode(*result);
+    }
+    else
+    {
+        auto value = Decoder<JsonType>::decode(*result);
+        if (!value)
+        {
+            return Result<PropertyType>{value.error()};
+        }
+        return Result<PropertyType>{std::move(*value)};
+    }
+}
+
+template <typename JsonType, typename PropertyType = typename Decoder<JsonType>::Value>
+Result<PropertyType> get(Firebolt::Helpers::IHelper& helper, Method method,
+                         const nlohmann::json& parameters = nlohmann::json({}))
+{
+    return get<JsonType, PropertyType>(helper, methodName(method), parameters);
+}
+
+/**
+ * @brief IHelper::invoke() of the method identified by method
+ */
+inline Result<void> invoke(Firebolt::Helpers::IHelper& helper, Method method, const nlohmann::json& parameters)
+{
+    return helper.invoke(methodName(method), parameters);
+}
+
+/**
+ * @brief Same as Helpers::SubscriptionManager, but decodes event payloads with Decoder and shares the platform
+ *        subscription of an event with every other listener of it through EventChannels
+ */
+class SubscriptionManager
+{
+public:
+    SubscriptionManager(Firebolt::Helpers::IHelper& helper, void* owner)
+        : channels_(EventChannels::of(helper)),
+          owner_(owner)
+    {
+    }
+    SubscriptionManager(const SubscriptionManager&) = delete;
+    SubscriptionManager& operator=(const SubscriptionManager&) = delete;
+    ~SubscriptionManager() { unsubscribeAll(); }
+
+    template <typename JsonType, typename PropertyType = typename Decoder<JsonType>::Value>
+    Result<SubscriptionId> subscribe(Method event, std::function<void(PropertyType)>&& notification)
+    {
+        return channels_->subscribe(owner_, methodName(event), typeid(Decoding<JsonType, PropertyType>),
+                                    dispatch<JsonType, PropertyType>, std::move(notification));
+    }
+
+    Result<void> unsubscribe(SubscriptionId id) { return channels_->unsubscribe(id); }
+    void unsubscribeAll() { channels_->unsubscribeAll(owner_); }
+
+private:
+    // Identifies the group of the listeners decoding JsonType into PropertyType
+    template <typename JsonType, typename PropertyType> struct Decoding
+    {
+    };
+
+    template <typename JsonType, typename PropertyType>
+    static void dispatch(const nlohmann::json& payload, const EventChannels::Listeners& listeners)
+    {
+        auto value = Decoder<JsonType>::decode(payload);
+        if (!value)
+        {
+            return;
+        }
+        for (std::size_t i = 0; i < listeners.size(); ++i)
+        {
+            (*listeners[i])(
+                [&](std::any& notification)
+                {
+                    auto& callback = *std::any_cast<std::function<void(PropertyType)>>(&notification);
+                    if (i + 1 < listeners.size())
+                    {
+                        callback(*value);
+                    }
+                    else
+                    {
+                        callback(std::move(*value));
+                    }
+                });
+        }
+    }
+
+    std::shared_ptr<EventChannels> channels_;
+    void* owner_;
+};
+} // namespace Firebolt::Internal
@@ -19,55 +19,29 @@
 #pragma once
 
 #include "firebolt/accessibility.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 
 namespace Firebolt::Accessibility::JsonData
 {
 
-class ClosedCaptionsSettings : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Accessibility::ClosedCaptionsSettings>
+class ClosedCaptionsSettings
+    : public Firebolt::Internal::JsonStruct<::Firebolt::Accessibility::ClosedCaptionsSettings, ClosedCaptionsSettings>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"enabled", "preferredLanguages"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        enabled_ = json["enabled"].get<bool>();
-        preferredLanguages_ = json["preferredLanguages"].get<std::vector<std::string>>();
-    }
-    ::Firebolt::Accessibility::ClosedCaptionsSettings value() const override
-    {
-        return ::Firebolt::Accessibility::ClosedCaptionsSettings{enabled_, preferredLanguages_};
-    }
-
-private:
-    bool enabled_;
-    std::vector<std::string> preferredLanguages_;
+    static constexpr auto fields = std::make_tuple(
+        field("enabled", &::Firebolt::Accessibility::ClosedCaptionsSettings::enabled),
+        field("preferredLanguages", &::Firebolt::Accessibility::ClosedCaptionsSettings::preferredLanguages));
 };
 
-class VoiceGuidanceSettings : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Accessibility::VoiceGuidanceSettings>
+class VoiceGuidanceSettings
+    : public Firebolt::Internal::JsonStruct<::Firebolt::Accessibility::VoiceGuidanceSettings, VoiceGuidanceSettings>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"enabled", "rate", "navigationHints"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        enabled_ = json["enabled"].get<bool>();
-        rate_ = json["rate"].get<double>();
-        navigationHints_ = json["navigationHints"].get<bool>();
-    }
-    ::Firebolt::Accessibility::VoiceGuidanceSettings value() const override
-    {
-        return ::Firebolt::Accessibility::VoiceGuidanceSettings{enabled_, rate_, navigationHints_};
-    }
-
-private:
-    bool enabled_;
-    double rate_;
-    bool navigationHints_;
+    static constexpr auto fields =
+        std::make_tuple(field("enabled", &::Firebolt::Accessibility::VoiceGuidanceSettings::enabled),
+                        field("rate", &::Firebolt::Accessibility::VoiceGuidanceSettings::rate),
+                        field("navigationHints", &::Firebolt::Accessibility::VoiceGuidanceSettings::navigationHints));
 };
 
 } // namespace Firebolt::Accessibility::JsonData
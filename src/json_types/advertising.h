@@ -19,30 +19,18 @@
 #pragma once
 
 #include "firebolt/advertising.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 #include <nlohmann/json.hpp>
 #include <string>
 
 namespace Firebolt::Advertising::JsonData
 {
-class IfaJson : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Advertising::Ifa>
+class IfaJson : public Firebolt::Internal::JsonStruct<::Firebolt::Advertising::Ifa, IfaJson>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"ifa", "ifa_type", "lmt"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        ifa = json["ifa"].get<std::string>();
-        ifa_type = json["ifa_type"].get<std::string>();
-        lmt = json["lmt"].get<std::string>();
-    }
-    ::Firebolt::Advertising::Ifa value() const override { return ::Firebolt::Advertising::Ifa{ifa, ifa_type, lmt}; }
-
-private:
-    std::string ifa;
-    std::string ifa_type;
-    std::string lmt;
+    static constexpr auto fields = std::make_tuple(field("ifa", &::Firebolt::Advertising::Ifa::ifa),
+                                                   field("ifa_type", &::Firebolt::Advertising::Ifa::ifa_type),
+                                                   field("lmt", &::Firebolt::Advertising::Ifa::lmt));
 };
 } // namespace Firebolt::Advertising::JsonData
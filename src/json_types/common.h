@@ -18,12 +18,13 @@
 
 #pragma once
 
+#include "enum_table.h"
 #include "firebolt/common_types.h"
 #include <firebolt/json_types.h>
 
 namespace Firebolt::JsonData
 {
-inline const Firebolt::JSON::EnumType<::Firebolt::AgePolicy> AgePolicyEnum({
+inline constexpr auto AgePolicyEnum = Firebolt::Internal::makeEnumTable<::Firebolt::AgePolicy>({
     {"app:adult", ::Firebolt::AgePolicy::ADULT},
     {"app:child", ::Firebolt::AgePolicy::CHILD},
     {"app:teen", ::Firebolt::AgePolicy::TEEN},
@@ -18,48 +18,33 @@
 
 #pragma once
 
+#include "enum_table.h"
 #include "firebolt/device.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 #include <nlohmann/json.hpp>
 
 namespace Firebolt::Device::JsonData
 {
 // Enums
-inline const Firebolt::JSON::EnumType<::Firebolt::Device::DeviceClass> DeviceClassEnum({
+inline constexpr auto DeviceClassEnum = Firebolt::Internal::makeEnumTable<::Firebolt::Device::DeviceClass>({
     {"stb", ::Firebolt::Device::DeviceClass::STB},
     {"ott", ::Firebolt::Device::DeviceClass::OTT},
     {"tv", ::Firebolt::Device::DeviceClass::TV},
 });
 
 // Types
-class DeviceClassJson : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Device::DeviceClass>
+class DeviceClassJson : public Firebolt::Internal::JsonEnum<::Firebolt::Device::DeviceClass, DeviceClassEnum>
 {
-public:
-    void fromJson(const nlohmann::json& json) override { deviceClass_ = DeviceClassEnum.at(json); }
-    ::Firebolt::Device::DeviceClass value() const override { return deviceClass_; }
-
-private:
-    ::Firebolt::Device::DeviceClass deviceClass_;
 };
 
-class HDRFormat : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Device::HDRFormat>
+class HDRFormat : public Firebolt::Internal::JsonStruct<::Firebolt::Device::HDRFormat, HDRFormat>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"hdr10", "hdr10Plus", "dolbyVision", "hlg"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        hdrFormat_.hdr10 = json["hdr10"].get<bool>();
-        hdrFormat_.hdr10Plus = json["hdr10Plus"].get<bool>();
-        hdrFormat_.dolbyVision = json["dolbyVision"].get<bool>();
-        hdrFormat_.hlg = json["hlg"].get<bool>();
-    }
-    ::Firebolt::Device::HDRFormat value() const override { return hdrFormat_; }
-
-private:
-    ::Firebolt::Device::HDRFormat hdrFormat_;
+    static constexpr auto fields = std::make_tuple(field("hdr10", &::Firebolt::Device::HDRFormat::hdr10),
+                                                   field("hdr10Plus", &::Firebolt::Device::HDRFormat::hdr10Plus),
+                                                   field("dolbyVision", &::Firebolt::Device::HDRFormat::dolbyVision),
+                                                   field("hlg", &::Firebolt::Device::HDRFormat::hlg));
 };
 
 } // namespace Firebolt::Device::JsonData
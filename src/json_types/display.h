@@ -19,6 +19,7 @@
 #pragma once
 
 #include "firebolt/display.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 #include <nlohmann/json.hpp>
 
@@ -26,23 +27,11 @@ namespace Firebolt::Display::JsonData
 {
 
 // Types
-class DisplaySizeJson : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Display::DisplaySize>
+class DisplaySizeJson : public Firebolt::Internal::JsonStruct<::Firebolt::Display::DisplaySize, DisplaySizeJson>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"width", "height"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        width_ = json["width"].get<uint32_t>();
-        height_ = json["height"].get<uint32_t>();
-    }
-    ::Firebolt::Display::DisplaySize value() const override { return Firebolt::Display::DisplaySize{width_, height_}; }
-
-private:
-    uint32_t width_;
-    uint32_t height_;
+    static constexpr auto fields = std::make_tuple(field("width", &::Firebolt::Display::DisplaySize::width),
+                                                   field("height", &::Firebolt::Display::DisplaySize::height));
 };
 
 } // namespace Firebolt::Display::JsonData
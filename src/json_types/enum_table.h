@@ -0,0 +1,149 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Compile-time mapping between the values of an enum and their JSON strings
+ *
+ * The enum values must be 0..N-1, in any order. name() indexes an array by the value. find() hashes the string
+ * with a seed that was searched at compile time to give every string its own slot, so a lookup is one hash and
+ * one string comparison. Tables are meant to be inline constexpr variables made with makeEnumTable(), which
+ * fails to compile if the values are not 0..N-1 or a string is listed twice.
+ */
+template <typename T, std::size_t N> class EnumTable
+{
+    static_assert(std::is_enum_v<T>, "EnumTable maps enum values");
+    static_assert(N > 0 && N < 255, "EnumTable supports 1 to 254 values");
+
+public:
+    struct Entry
+    {
+        std::string_view first;
+        T second;
+    };
+
+    constexpr explicit EnumTable(const Entry (&entries)[N])
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            entries_[i] = entries[i];
+            auto value = static_cast<std::size_t>(entries[i].second);
+            if (value >= N || names_[value].data() != nullptr)
+            {
+                invalidTable("enum values must be 0..N-1, each listed once");
+            }
+            names_[value] = entries[i].first;
+        }
+        for (seed_ = 0; !placeAll(); ++seed_)
+        {
+            if (seed_ == MaxSeed)
+            {
+                invalidTable("no perfect hash seed found, is a string listed twice?");
+            }
+        }
+    }
+
+    constexpr std::optional<T> find(std::string_view name) const
+    {
+        uint8_t slot = slots_[hash(name, seed_) & (Slots - 1)];
+        if (slot != 0 && entries_[slot - 1].first == name)
+        {
+            return entries_[slot - 1].second;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @return The string of value, or an empty string for a value outside the enum
+     */
+    constexpr std::string_view name(T value) const
+    {
+        auto index = static_cast<std::size_t>(value);
+        return index < N ? names_[index] : std::string_view{};
+    }
+
+    constexpr std::size_t size() const { return N; }
+    constexpr bool empty() const { return false; }
+    constexpr const Entry* begin() const { return entries_.data(); }
+    constexpr const Entry* end() const { return entries_.data() + N; }
+
+private:
+    // Twice the entries, rounded up to a power of two, keeps the seed search short
+    static constexpr std::size_t slotCount()
+    {
+        std::size_t slots = 2;
+        while (slots < 2 * N)
+        {
+            slots *= 2;
+        }
+        return slots;
+    }
+    static constexpr std::size_t Slots = slotCount();
+    static constexpr uint32_t MaxSeed = 100000;
+
+    // FNV-1a with the seed mixed into the offset basis
+    static constexpr uint32_t hash(std::string_view text, uint32_t seed)
+    {
+        uint32_t hash = 2166136261u ^ (seed * 2654435761u);
+        for (char c : text)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    constexpr bool placeAll()
+    {
+        slots_ = {};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            uint8_t& slot = slots_[hash(entries_[i].first, seed_) & (Slots - 1)];
+            if (slot != 0)
+            {
+                return false;
+            }
+            slot = static_cast<uint8_t>(i + 1);
+        }
+        return true;
+    }
+
+    // Not constexpr, so reaching it while building a table is a compile error
+    static void invalidTable(const char*) {}
+
+    std::array<Entry, N> entries_{};
+    std::array<std::string_view, N> names_{};
+    std::array<uint8_t, Slots> slots_{};
+    uint32_t seed_ = 0;
+};
+
+template <typename T, std::size_t N>
+constexpr EnumTable<T, N> makeEnumTable(const typename EnumTable<T, N>::Entry (&entries)[N])
+{
+    return EnumTable<T, N>(entries);
+}
+} // namespace Firebolt::Internal
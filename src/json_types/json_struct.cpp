@@ -0,0 +1,57 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "json_struct.h"
+#include <stdexcept>
+#include <utility>
+
+namespace Firebolt::Internal
+{
+#if !__cpp_exceptions
+// Set by decodeFailed() in a build without exceptions, read back by applyFromJson()
+static thread_local bool decodeFailure = false;
+#endif
+
+void decodeFailed([[maybe_unused]] const char* message)
+{
+#if __cpp_exceptions
+    throw std::invalid_argument(message);
+#else
+    decodeFailure = true;
+#endif
+}
+
+bool applyFromJson(void* target, const nlohmann::json& json, void (*apply)(void* target, const nlohmann::json& json))
+{
+#if __cpp_exceptions
+    try
+    {
+        apply(target, json);
+    }
+    catch (...)
+    {
+        return false;
+    }
+    return true;
+#else
+    decodeFailure = false;
+    apply(target, json);
+    return !std::exchange(decodeFailure, false);
+#endif
+}
+} // namespace Firebolt::Internal
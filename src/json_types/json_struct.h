@@ -0,0 +1,329 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "enum_table.h"
+#include <cstddef>
+#include <cstdint>
+#include <firebolt/json_types.h>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Reports a JSON value that does not match its JsonData type from NL_Json_Basic::fromJson()
+ *
+ * fromJson() has no other way to fail than throwing, which decodeFailed() does when the library is built with
+ * exceptions. Without them the failure is recorded for fromJson() below to return, and the caller returns right
+ * after. Defined in the library so that every translation unit gets the same behavior, whatever its own flags.
+ */
+void decodeFailed(const char* message);
+
+/**
+ * @brief Calls apply(target, json) and tells whether it reported a failure, see decodeFailed()
+ */
+bool applyFromJson(void* target, const nlohmann::json& json, void (*apply)(void* target, const nlohmann::json& json));
+
+/**
+ * @brief Calls jsonType.fromJson(json)
+ * @return false if it failed, see decodeFailed()
+ */
+template <typename JsonType> bool fromJson(JsonType& jsonType, const nlohmann::json& json)
+{
+    return applyFromJson(&jsonType, json, [](void* target, const nlohmann::json& value)
+                         { static_cast<JsonType*>(target)->fromJson(value); });
+}
+
+template <typename T> struct IsVector : std::false_type
+{
+};
+template <typename T> struct IsVector<std::vector<T>> : std::true_type
+{
+};
+template <typename T> struct IsOptional : std::false_type
+{
+};
+template <typename T> struct IsOptional<std::optional<T>> : std::true_type
+{
+};
+
+/**
+ * @brief Reads a JSON value into value, checking its type first so that nlohmann::json never throws
+ * @return false if the JSON value has another type than value
+ */
+template <typename M> bool readJson(const nlohmann::json& json, M& value)
+{
+    if constexpr (std::is_same_v<M, bool>)
+    {
+        if (!json.is_boolean())
+        {
+            return false;
+        }
+        value = json.get<bool>();
+    }
+    else if constexpr (std::is_enum_v<M>)
+    {
+        std::underlying_type_t<M> number{};
+        if (!readJson(json, number))
+        {
+            return false;
+        }
+        value = static_cast<M>(number);
+    }
+    else if constexpr (std::is_arithmetic_v<M>)
+    {
+        if (!json.is_number())
+        {
+            return false;
+        }
+        value = json.get<M>();
+    }
+    else if constexpr (std::is_same_v<M, std::string>)
+    {
+        if (!json.is_string())
+        {
+            return false;
+        }
+        value = json.get_ref<const std::string&>();
+    }
+    else if constexpr (IsVector<M>::value)
+    {
+        if (!json.is_array())
+        {
+            return false;
+        }
+        value.clear();
+        value.reserve(json.size());
+        for (const auto& element : json)
+        {
+            if (!readJson(element, value.emplace_back()))
+            {
+                return false;
+            }
+        }
+    }
+    else if constexpr (IsOptional<M>::value)
+    {
+        if (json.is_null())
+        {
+            value.reset();
+            return true;
+        }
+        return readJson(json, value.emplace());
+    }
+    else
+    {
+        static_assert(IsOptional<M>::value, "readJson does not support this type");
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a JSON string that is one of the strings of values
+ * @return false if the JSON value is not a string or not one of the strings
+ */
+template <typename M, std::size_t N>
+bool readJson(const nlohmann::json& json, M& value, const EnumTable<M, N>& values)
+{
+    if (!json.is_string())
+    {
+        return false;
+    }
+    std::optional<M> found = values.find(json.get_ref<const std::string&>());
+    if (!found)
+    {
+        return false;
+    }
+    value = *found;
+    return true;
+}
+
+/**
+ * @brief JSON name of a struct member. Enum members are carried as their numeric value.
+ */
+template <typename T, typename M> struct Field
+{
+    std::string_view name;
+    M T::*member;
+};
+
+/**
+ * @brief JSON name of an enum struct member carried as one of the strings of an EnumTable
+ */
+template <typename T, typename M, std::size_t N> struct EnumField
+{
+    std::string_view name;
+    M T::*member;
+    const EnumTable<M, N>* values;
+};
+
+/**
+ * @brief JsonData type of a public struct whose JSON mapping is declared once as field descriptors
+ *
+ * The derived class lists the members in a static constexpr tuple named fields, e.g.
+ *
+ *     class HDRFormat : public Firebolt::Internal::JsonStruct<::Firebolt::Device::HDRFormat, HDRFormat>
+ *     {
+ *     public:
+ *         static constexpr auto fields = std::make_tuple(field("hdr10", &::Firebolt::Device::HDRFormat::hdr10), ...);
+ *     };
+ *
+ * All fields are required. fromJson() walks the JSON object once and dispatches each key to its member,
+ * instead of looking every field up by name.
+ */
+template <typename T, typename Derived> class JsonStruct : public Firebolt::JSON::NL_Json_Basic<T>
+{
+public:
+    using ValueType = T;
+
+    void fromJson(const nlohmann::json& json) override
+    {
+        if (!decode(json, value_))
+        {
+            decodeFailed("Missing required fields in JSON");
+        }
+    }
+    T value() const override { return value_; }
+    T take() && { return std::move(value_); }
+
+    /**
+     * @return false if a field is missing or has the wrong type, value is then partially filled
+     */
+    static bool decode(const nlohmann::json& json, T& value)
+    {
+        if (!json.is_object())
+        {
+            return false;
+        }
+        uint64_t seen = 0;
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            uint64_t field = decodeField(it.key(), it.value(), value, std::make_index_sequence<fieldCount()>{});
+            if (field == Invalid)
+            {
+                return false;
+            }
+            seen |= field;
+        }
+        return seen == (uint64_t{1} << fieldCount()) - 1;
+    }
+
+    static nlohmann::json toJson(const T& value)
+    {
+        nlohmann::json json = nlohmann::json::object();
+        std::apply([&](const auto&... field) { ((json[std::string(field.name)] = encode(field, value)), ...); },
+                   Derived::fields);
+        return json;
+    }
+
+protected:
+    template <typename M> static constexpr Field<T, M> field(std::string_view name, M T::*member)
+    {
+        return Field<T, M>{name, member};
+    }
+    template <typename M, std::size_t N>
+    static constexpr EnumField<T, M, N> field(std::string_view name, M T::*member, const EnumTable<M, N>& values)
+    {
+        return EnumField<T, M, N>{name, member, &values};
+    }
+
+private:
+    // Derived is still incomplete where this base is instantiated, so its fields are only looked at from functions
+    static constexpr std::size_t fieldCount()
+    {
+        constexpr std::size_t count = std::tuple_size_v<std::decay_t<decltype(Derived::fields)>>;
+        static_assert(count > 0 && count < 64, "JsonStruct supports 1 to 63 fields");
+        return count;
+    }
+
+    static constexpr uint64_t Invalid = ~uint64_t{0};
+
+    // Returns the bit of the field named key, 0 for an unknown key or Invalid if the value does not fit the member
+    template <std::size_t... I>
+    static uint64_t decodeField(std::string_view key, const nlohmann::json& json, T& value, std::index_sequence<I...>)
+    {
+        uint64_t seen = 0;
+        // Stops at the first field with this name
+        (void)((std::get<I>(Derived::fields).name == key &&
+                (seen = decodeMember(std::get<I>(Derived::fields), json, value) ? uint64_t{1} << I : Invalid, true)) ||
+               ...);
+        return seen;
+    }
+
+    template <typename M> static bool decodeMember(const Field<T, M>& field, const nlohmann::json& json, T& value)
+    {
+        return readJson(json, value.*field.member);
+    }
+    template <typename M, std::size_t N>
+    static bool decodeMember(const EnumField<T, M, N>& field, const nlohmann::json& json, T& value)
+    {
+        return readJson(json, value.*field.member, *field.values);
+    }
+
+    template <typename M> static auto encode(const Field<T, M>& field, const T& value)
+    {
+        if constexpr (std::is_enum_v<M>)
+        {
+            return static_cast<std::underlying_type_t<M>>(value.*field.member);
+        }
+        else
+        {
+            return value.*field.member;
+        }
+    }
+    template <typename M, std::size_t N>
+    static std::string_view encode(const EnumField<T, M, N>& field, const T& value)
+    {
+        return field.values->name(value.*field.member);
+    }
+
+    T value_{};
+};
+
+/**
+ * @brief JsonData type of an enum carried as one of the strings of Values
+ */
+template <typename T, const auto& Values> class JsonEnum : public Firebolt::JSON::NL_Json_Basic<T>
+{
+public:
+    using ValueType = T;
+
+    void fromJson(const nlohmann::json& json) override
+    {
+        if (!decode(json, value_))
+        {
+            decodeFailed("Invalid enum value in JSON");
+        }
+    }
+    T value() const override { return value_; }
+    T take() && { return std::move(value_); }
+
+    static bool decode(const nlohmann::json& json, T& value) { return readJson(json, value, Values); }
+
+private:
+    T value_{};
+};
+} // namespace Firebolt::Internal
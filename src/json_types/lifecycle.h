@@ -18,20 +18,22 @@
 
 #pragma once
 
+#include "enum_table.h"
 #include "firebolt/lifecycle.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 
 namespace Firebolt::Lifecycle::JsonData
 {
 
-inline const Firebolt::JSON::EnumType<::Firebolt::Lifecycle::CloseType> CloseReasonEnum({
+inline constexpr auto CloseReasonEnum = Firebolt::Internal::makeEnumTable<::Firebolt::Lifecycle::CloseType>({
     {"deactivate", ::Firebolt::Lifecycle::CloseType::DEACTIVATE},
     {"unload", ::Firebolt::Lifecycle::CloseType::UNLOAD},
     {"killReload", ::Firebolt::Lifecycle::CloseType::KILL_RELOAD},
     {"killReactivate", ::Firebolt::Lifecycle::CloseType::KILL_REACTIVATE},
 });
 
-inline const Firebolt::JSON::EnumType<::Firebolt::Lifecycle::LifecycleState> LifecycleStateEnum({
+inline constexpr auto LifecycleStateEnum = Firebolt::Internal::makeEnumTable<::Firebolt::Lifecycle::LifecycleState>({
     {"initializing", ::Firebolt::Lifecycle::LifecycleState::INITIALIZING},
     {"active", ::Firebolt::Lifecycle::LifecycleState::ACTIVE},
     {"paused", ::Firebolt::Lifecycle::LifecycleState::PAUSED},
@@ -40,36 +42,16 @@ inline const Firebolt::JSON::EnumType<::Firebolt::Lifecycle::LifecycleState> Lif
     {"terminating", ::Firebolt::Lifecycle::LifecycleState::TERMINATING},
 });
 
-class LifecycleState : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Lifecycle::LifecycleState>
+class LifecycleState : public Firebolt::Internal::JsonEnum<::Firebolt::Lifecycle::LifecycleState, LifecycleStateEnum>
 {
-public:
-    void fromJson(const nlohmann::json& json) override { state_ = LifecycleStateEnum.at(json.get<std::string>()); }
-    ::Firebolt::Lifecycle::LifecycleState value() const override { return state_; }
-
-private:
-    ::Firebolt::Lifecycle::LifecycleState state_;
 };
 
-class StateChange : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Lifecycle::StateChange>
+class StateChange : public Firebolt::Internal::JsonStruct<::Firebolt::Lifecycle::StateChange, StateChange>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"oldState", "newState"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        oldState_ = LifecycleStateEnum.at(json["oldState"]);
-        newState_ = LifecycleStateEnum.at(json["newState"]);
-    }
-    ::Firebolt::Lifecycle::StateChange value() const override
-    {
-        return ::Firebolt::Lifecycle::StateChange{oldState_, newState_};
-    }
-
-private:
-    ::Firebolt::Lifecycle::LifecycleState oldState_;
-    ::Firebolt::Lifecycle::LifecycleState newState_;
+    static constexpr auto fields =
+        std::make_tuple(field("oldState", &::Firebolt::Lifecycle::StateChange::oldState, LifecycleStateEnum),
+                        field("newState", &::Firebolt::Lifecycle::StateChange::newState, LifecycleStateEnum));
 };
 
 } // namespace Firebolt::Lifecycle::JsonData
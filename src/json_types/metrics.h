@@ -18,12 +18,13 @@
 
 #pragma once
 
+#include "enum_table.h"
 #include "firebolt/metrics.h"
 #include <firebolt/json_types.h>
 
 namespace Firebolt::Metrics::JsonData
 {
-inline const Firebolt::JSON::EnumType<::Firebolt::Metrics::ErrorType> ErrorTypeEnum({
+inline constexpr auto ErrorTypeEnum = Firebolt::Internal::makeEnumTable<::Firebolt::Metrics::ErrorType>({
     {"network", ::Firebolt::Metrics::ErrorType::Network},
     {"media", ::Firebolt::Metrics::ErrorType::Media},
     {"restriction", ::Firebolt::Metrics::ErrorType::Restriction},
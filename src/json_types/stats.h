@@ -19,35 +19,19 @@
 #pragma once
 
 #include "firebolt/stats.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 #include <nlohmann/json.hpp>
 
 namespace Firebolt::Stats::JsonData
 {
-class MemoryInfo : public Firebolt::JSON::NL_Json_Basic<::Firebolt::Stats::MemoryInfo>
+class MemoryInfo : public Firebolt::Internal::JsonStruct<::Firebolt::Stats::MemoryInfo, MemoryInfo>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json,
-                                 {"userMemoryUsedKiB", "userMemoryLimitKiB", "gpuMemoryUsedKiB", "gpuMemoryLimitKiB"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        userMemoryUsed = json["userMemoryUsedKiB"].get<uint32_t>();
-        userMemoryLimit = json["userMemoryLimitKiB"].get<uint32_t>();
-        gpuMemoryUsed = json["gpuMemoryUsedKiB"].get<uint32_t>();
-        gpuMemoryLimit = json["gpuMemoryLimitKiB"].get<uint32_t>();
-    }
-    ::Firebolt::Stats::MemoryInfo value() const override
-    {
-        return ::Firebolt::Stats::MemoryInfo{userMemoryUsed, userMemoryLimit, gpuMemoryUsed, gpuMemoryLimit};
-    }
-
-private:
-    uint32_t userMemoryUsed;
-    uint32_t userMemoryLimit;
-    uint32_t gpuMemoryUsed;
-    uint32_t gpuMemoryLimit;
+    static constexpr auto fields =
+        std::make_tuple(field("userMemoryUsedKiB", &::Firebolt::Stats::MemoryInfo::userMemoryUsed),
+                        field("userMemoryLimitKiB", &::Firebolt::Stats::MemoryInfo::userMemoryLimit),
+                        field("gpuMemoryUsedKiB", &::Firebolt::Stats::MemoryInfo::gpuMemoryUsed),
+                        field("gpuMemoryLimitKiB", &::Firebolt::Stats::MemoryInfo::gpuMemoryLimit));
 };
 } // namespace Firebolt::Stats::JsonData
@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include "enum_table.h"
 #include "firebolt/texttospeech.h"
+#include "json_struct.h"
 #include <firebolt/json_types.h>
 
 namespace Firebolt::TextToSpeech::JsonData
 {
-inline const Firebolt::JSON::EnumType<Firebolt::TextToSpeech::SpeechRate> SpeechRateEnum({
+inline constexpr auto SpeechRateEnum = Firebolt::Internal::makeEnumTable<Firebolt::TextToSpeech::SpeechRate>({
     {"slow", ::Firebolt::TextToSpeech::SpeechRate::SLOW},
     {"medium", ::Firebolt::TextToSpeech::SpeechRate::MEDIUM},
     {"fast", ::Firebolt::TextToSpeech::SpeechRate::FAST},
@@ -31,120 +33,48 @@ inline const Firebolt::JSON::EnumType<Firebolt::TextToSpeech::SpeechRate> Speech
     {"fastest", ::Firebolt::TextToSpeech::SpeechRate::FASTEST},
 });
 
-class ListVoicesResponse : public Firebolt::JSON::NL_Json_Basic<::Firebolt::TextToSpeech::ListVoicesResponse>
+class ListVoicesResponse
+    : public Firebolt::Internal::JsonStruct<::Firebolt::TextToSpeech::ListVoicesResponse, ListVoicesResponse>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"TTS_Status", "voices"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        ttsStatus_ = json["TTS_Status"].get<uint32_t>();
-        voices_.clear();
-        for (const auto& voice : json["voices"])
-        {
-            voices_.push_back(voice.get<std::string>());
-        }
-    }
-    ::Firebolt::TextToSpeech::ListVoicesResponse value() const override
-    {
-        return ::Firebolt::TextToSpeech::ListVoicesResponse{ttsStatus_, voices_};
-    }
-
-private:
-    uint32_t ttsStatus_;
-    std::vector<std::string> voices_;
+    static constexpr auto fields =
+        std::make_tuple(field("TTS_Status", &::Firebolt::TextToSpeech::ListVoicesResponse::ttsStatus),
+                        field("voices", &::Firebolt::TextToSpeech::ListVoicesResponse::voices));
 };
 
-class SpeechIdEvent : public Firebolt::JSON::NL_Json_Basic<::Firebolt::TextToSpeech::SpeechIdEvent>
+class SpeechIdEvent : public Firebolt::Internal::JsonStruct<::Firebolt::TextToSpeech::SpeechIdEvent, SpeechIdEvent>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"speechid"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        speechId_ = json["speechid"].get<uint32_t>();
-    }
-    ::Firebolt::TextToSpeech::SpeechIdEvent value() const override
-    {
-        return ::Firebolt::TextToSpeech::SpeechIdEvent{speechId_};
-    }
-
-private:
-    uint32_t speechId_;
+    static constexpr auto fields =
+        std::make_tuple(field("speechid", &::Firebolt::TextToSpeech::SpeechIdEvent::speechId));
 };
 
-class SpeechResponse : public Firebolt::JSON::NL_Json_Basic<::Firebolt::TextToSpeech::SpeechResponse>
+class SpeechResponse : public Firebolt::Internal::JsonStruct<::Firebolt::TextToSpeech::SpeechResponse, SpeechResponse>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"speechid", "TTS_Status", "success"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        speechId_ = json["speechid"].get<uint32_t>();
-        ttsStatus_ = json["TTS_Status"].get<uint32_t>();
-        success_ = json["success"].get<bool>();
-    }
-    ::Firebolt::TextToSpeech::SpeechResponse value() const override
-    {
-        return ::Firebolt::TextToSpeech::SpeechResponse{speechId_, ttsStatus_, success_};
-    }
-
-private:
-    uint32_t speechId_;
-    uint32_t ttsStatus_;
-    bool success_;
+    static constexpr auto fields =
+        std::make_tuple(field("speechid", &::Firebolt::TextToSpeech::SpeechResponse::speechId),
+                        field("TTS_Status", &::Firebolt::TextToSpeech::SpeechResponse::ttsStatus),
+                        field("success", &::Firebolt::TextToSpeech::SpeechResponse::success));
 };
 
-class SpeechStateResponse : public Firebolt::JSON::NL_Json_Basic<::Firebolt::TextToSpeech::SpeechStateResponse>
+class SpeechStateResponse
+    : public Firebolt::Internal::JsonStruct<::Firebolt::TextToSpeech::SpeechStateResponse, SpeechStateResponse>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"speechstate", "TTS_Status", "success"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        speechState_ = static_cast<SpeechState>(json["speechstate"].get<uint32_t>());
-        ttsStatus_ = json["TTS_Status"].get<uint32_t>();
-        success_ = json["success"].get<bool>();
-    }
-    ::Firebolt::TextToSpeech::SpeechStateResponse value() const override
-    {
-        return ::Firebolt::TextToSpeech::SpeechStateResponse{speechState_, ttsStatus_, success_};
-    }
-
-private:
-    SpeechState speechState_;
-    uint32_t ttsStatus_;
-    bool success_;
+    static constexpr auto fields =
+        std::make_tuple(field("speechstate", &::Firebolt::TextToSpeech::SpeechStateResponse::speechState),
+                        field("TTS_Status", &::Firebolt::TextToSpeech::SpeechStateResponse::ttsStatus),
+                        field("success", &::Firebolt::TextToSpeech::SpeechStateResponse::success));
 };
 
-class TTSStatusResponse : public Firebolt::JSON::NL_Json_Basic<::Firebolt::TextToSpeech::TTSStatusResponse>
+class TTSStatusResponse
+    : public Firebolt::Internal::JsonStruct<::Firebolt::TextToSpeech::TTSStatusResponse, TTSStatusResponse>
 {
 public:
-    void fromJson(const nlohmann::json& json) override
-    {
-        if (!checkRequiredFields(json, {"TTS_Status", "success"}))
-        {
-            throw std::invalid_argument("Missing required fields in JSON");
-        }
-        ttsStatus_ = json["TTS_Status"].get<uint32_t>();
-        success_ = json["success"].get<bool>();
-    }
-    ::Firebolt::TextToSpeech::TTSStatusResponse value() const override
-    {
-        return ::Firebolt::TextToSpeech::TTSStatusResponse{ttsStatus_, success_};
-    }
-
-private:
-    uint32_t ttsStatus_;
-    bool success_;
+    static constexpr auto fields =
+        std::make_tuple(field("TTS_Status", &::Firebolt::TextToSpeech::TTSStatusResponse::ttsStatus),
+                        field("success", &::Firebolt::TextToSpeech::TTSStatusResponse::success));
 };
 
 } // namespace Firebolt::TextToSpeech::JsonData
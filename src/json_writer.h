@@ -0,0 +1,50 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Builds the parameters of an IHelper call field by field, skipping absent optional fields
+ */
+class JsonDomWriter
+{
+public:
+    template <typename T> void field(std::string_view key, const T& value) { json_[std::string(key)] = value; }
+    template <typename T> void field(std::string_view key, const std::optional<T>& value)
+    {
+        if (value)
+        {
+            field(key, *value);
+        }
+    }
+
+    const nlohmann::json& finish() const& { return json_; }
+    nlohmann::json finish() && { return std::move(json_); }
+
+private:
+    nlohmann::json json_;
+};
+} // namespace Firebolt::Internal
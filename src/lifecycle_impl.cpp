@@ -23,6 +23,7 @@
 #include <string>
 
 using namespace Firebolt::Helpers;
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Lifecycle
 {
@@ -37,20 +38,20 @@ LifecycleImpl::~LifecycleImpl() {}
 Result<void> LifecycleImpl::close(const CloseType& reason) const
 {
     nlohmann::json params;
-    params["type"] = Firebolt::JSON::toString(JsonData::CloseReasonEnum, reason);
-    return helper_.invoke("Lifecycle2.close", params);
+    params["type"] = JsonData::CloseReasonEnum.name(reason);
+    return Firebolt::Internal::invoke(helper_, Method::Lifecycle2Close, params);
 }
 
 Result<LifecycleState> LifecycleImpl::state() const
 {
-    return helper_.get<JsonData::LifecycleState, LifecycleState>("Lifecycle2.state");
+    return Firebolt::Internal::get<JsonData::LifecycleState, LifecycleState>(helper_, Method::Lifecycle2State);
 }
 
 Result<SubscriptionId>
 LifecycleImpl::subscribeOnStateChanged(std::function<void(const std::vector<StateChange>&)>&& notification)
 {
     return subscriptionManager_
-        .subscribe<Firebolt::JSON::NL_Json_Array<JsonData::StateChange, StateChange>>("Lifecycle2.onStateChanged",
+        .subscribe<Firebolt::JSON::NL_Json_Array<JsonData::StateChange, StateChange>>(Method::Lifecycle2OnStateChanged,
                                                                                       std::move(notification));
 }
 
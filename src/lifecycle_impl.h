@@ -19,6 +19,7 @@
 #pragma once
 
 #include "firebolt/lifecycle.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
 
 class LifecycleTest;
@@ -51,7 +52,7 @@ public:
 private:
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
 
 public:
     friend class ::LifecycleTest;
@@ -19,47 +19,54 @@
 #include "localization_impl.h"
 #include <firebolt/json_types.h>
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Localization
 {
 LocalizationImpl::LocalizationImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper),
-      subscriptionManager_(helper, this)
+      subscriptionManager_(helper, this),
+      country_(helper, Method::LocalizationCountry, Method::LocalizationOnCountryChanged),
+      preferredAudioLanguages_(helper, Method::LocalizationPreferredAudioLanguages,
+                               Method::LocalizationOnPreferredAudioLanguagesChanged),
+      presentationLanguage_(helper, Method::LocalizationPresentationLanguage,
+                            Method::LocalizationOnPresentationLanguageChanged)
 {
 }
 
 Result<std::string> LocalizationImpl::country() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Localization.country");
+    return country_.get();
 }
 
 Result<std::vector<std::string>> LocalizationImpl::preferredAudioLanguages() const
 {
-    return helper_.get<Firebolt::JSON::NL_Json_Array<Firebolt::JSON::String, std::string>, std::vector<std::string>>(
-        "Localization.preferredAudioLanguages");
+    return preferredAudioLanguages_.get();
 }
 
 Result<std::string> LocalizationImpl::presentationLanguage() const
 {
-    return helper_.get<Firebolt::JSON::String, std::string>("Localization.presentationLanguage");
+    return presentationLanguage_.get();
 }
 
 Result<SubscriptionId> LocalizationImpl::subscribeOnCountryChanged(std::function<void(const std::string&)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::String>("Localization.onCountryChanged",
+    return subscriptionManager_.subscribe<Firebolt::JSON::String>(Method::LocalizationOnCountryChanged,
                                                                   std::move(notification));
 }
 
 Result<SubscriptionId> LocalizationImpl::subscribeOnPreferredAudioLanguagesChanged(
     std::function<void(const std::vector<std::string>&)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::NL_Json_Array<
-        Firebolt::JSON::String, std::string>>("Localization.onPreferredAudioLanguagesChanged", std::move(notification));
+    return subscriptionManager_
+        .subscribe<Firebolt::JSON::NL_Json_Array<Firebolt::JSON::String, std::string>>(
+            Method::LocalizationOnPreferredAudioLanguagesChanged, std::move(notification));
 }
 
 Result<SubscriptionId>
 LocalizationImpl::subscribeOnPresentationLanguageChanged(std::function<void(const std::string&)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::String>("Localization.onPresentationLanguageChanged",
+    return subscriptionManager_.subscribe<Firebolt::JSON::String>(Method::LocalizationOnPresentationLanguageChanged,
                                                                   std::move(notification));
 }
 
@@ -72,4 +79,18 @@ void LocalizationImpl::unsubscribeAll()
 {
     subscriptionManager_.unsubscribeAll();
 }
+
+void LocalizationImpl::configure(const ClientOptions& options)
+{
+    country_.setEnabled(options.propertyCache);
+    preferredAudioLanguages_.setEnabled(options.propertyCache);
+    presentationLanguage_.setEnabled(options.propertyCache);
+}
+
+void LocalizationImpl::onConnectionChanged(bool /*connected*/)
+{
+    country_.invalidate();
+    preferredAudioLanguages_.invalidate();
+    presentationLanguage_.invalidate();
+}
 } // namespace Firebolt::Localization
@@ -18,8 +18,12 @@
 
 #pragma once
 
+#include "cached_property.h"
+#include "firebolt/client_options.h"
 #include "firebolt/localization.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
+#include <firebolt/json_types.h>
 
 namespace Firebolt::Localization
 {
@@ -47,9 +51,18 @@ public:
     Result<void> unsubscribe(SubscriptionId id) override;
     void unsubscribeAll() override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
+
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::String, std::string> country_;
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::NL_Json_Array<Firebolt::JSON::String, std::string>,
+                                               std::vector<std::string>>
+        preferredAudioLanguages_;
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::String, std::string> presentationLanguage_;
 };
 
 } // namespace Firebolt::Localization
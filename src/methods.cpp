@@ -0,0 +1,36 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "methods.h"
+
+namespace Firebolt::Internal
+{
+const std::string& methodName(Method method)
+{
+    static const std::array<std::string, MethodCount> names = []
+    {
+        std::array<std::string, MethodCount> names;
+        for (std::size_t i = 0; i < MethodCount; ++i)
+        {
+            names[i] = std::string(MethodNames[static_cast<Method>(i)]);
+        }
+        return names;
+    }();
+    return names[static_cast<std::size_t>(method)];
+}
+} // namespace Firebolt::Internal
@@ -0,0 +1,223 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Identifier of a Firebolt method or event used by the client
+ *
+ * Calls name their method by identifier instead of by string literal. The transport still takes the name as a
+ * std::string, which methodName() hands out from strings built once, so no call constructs one.
+ */
+enum class Method : uint8_t
+{
+    AccessibilityAudioDescription,
+    AccessibilityClosedCaptionsSettings,
+    AccessibilityHighContrastUI,
+    AccessibilityOnAudioDescriptionChanged,
+    AccessibilityOnClosedCaptionsSettingsChanged,
+    AccessibilityOnHighContrastUIChanged,
+    AccessibilityOnVoiceGuidanceSettingsChanged,
+    AccessibilityVoiceGuidanceSettings,
+    ActionsIntent,
+    ActionsOnIntent,
+    AdvertisingAdvertisingId,
+    DeviceChipsetId,
+    DeviceDeviceClass,
+    DeviceHdr,
+    DeviceOnHdrChanged,
+    DeviceTimeInActiveState,
+    DeviceUid,
+    DeviceUptime,
+    DiscoveryWatched,
+    DiscoveryWatchedV2,
+    DisplayEdid,
+    DisplayMaxResolution,
+    DisplaySize,
+    Lifecycle2Close,
+    Lifecycle2OnStateChanged,
+    Lifecycle2State,
+    LocalizationCountry,
+    LocalizationOnCountryChanged,
+    LocalizationOnPreferredAudioLanguagesChanged,
+    LocalizationOnPresentationLanguageChanged,
+    LocalizationPreferredAudioLanguages,
+    LocalizationPresentationLanguage,
+    MetricsAppInfo,
+    MetricsError,
+    MetricsEvent,
+    MetricsMediaEnded,
+    MetricsMediaLoadStart,
+    MetricsMediaPause,
+    MetricsMediaPlay,
+    MetricsMediaPlaying,
+    MetricsMediaRateChanged,
+    MetricsMediaRenditionChanged,
+    MetricsMediaSeeked,
+    MetricsMediaSeeking,
+    MetricsMediaWaiting,
+    MetricsPage,
+    MetricsReady,
+    MetricsSignIn,
+    MetricsSignOut,
+    MetricsStartContent,
+    MetricsStopContent,
+    NetworkConnected,
+    NetworkOnConnectedChanged,
+    PresentationFocused,
+    PresentationOnFocusedChanged,
+    StatsMemoryUsage,
+    TextToSpeechCancel,
+    TextToSpeechGetspeechstate,
+    TextToSpeechListvoices,
+    TextToSpeechOnNetworkerror,
+    TextToSpeechOnPlaybackerror,
+    TextToSpeechOnSpeechcomplete,
+    TextToSpeechOnSpeechinterrupted,
+    TextToSpeechOnSpeechpause,
+    TextToSpeechOnSpeechresume,
+    TextToSpeechOnSpeechstart,
+    TextToSpeechOnWillspeak,
+    TextToSpeechPause,
+    TextToSpeechResume,
+    TextToSpeechSpeak,
+    Count
+};
+
+constexpr std::size_t MethodCount = static_cast<std::size_t>(Method::Count);
+
+/**
+ * @brief Names of all methods, indexed by their identifier
+ */
+class MethodTable
+{
+public:
+    struct Entry
+    {
+        Method method;
+        std::string_view name;
+    };
+
+    constexpr explicit MethodTable(const Entry (&entries)[MethodCount])
+    {
+        for (const Entry& entry : entries)
+        {
+            auto index = static_cast<std::size_t>(entry.method);
+            if (index >= MethodCount || names_[index].data() != nullptr)
+            {
+                invalidTable("every method must be listed once");
+            }
+            names_[index] = entry.name;
+        }
+    }
+
+    constexpr std::string_view operator[](Method method) const { return names_[static_cast<std::size_t>(method)]; }
+
+private:
+    // Not constexpr, so reaching it while building the table is a compile error
+    static void invalidTable(const char*) {}
+
+    std::array<std::string_view, MethodCount> names_{};
+};
+
+inline constexpr MethodTable MethodNames({
+    {Method::AccessibilityAudioDescription, "Accessibility.audioDescription"},
+    {Method::AccessibilityClosedCaptionsSettings, "Accessibility.closedCaptionsSettings"},
+    {Method::AccessibilityHighContrastUI, "Accessibility.highContrastUI"},
+    {Method::AccessibilityOnAudioDescriptionChanged, "Accessibility.onAudioDescriptionChanged"},
+    {Method::AccessibilityOnClosedCaptionsSettingsChanged, "Accessibility.onClosedCaptionsSettingsChanged"},
+    {Method::AccessibilityOnHighContrastUIChanged, "Accessibility.onHighContrastUIChanged"},
+    {Method::AccessibilityOnVoiceGuidanceSettingsChanged, "Accessibility.onVoiceGuidanceSettingsChanged"},
+    {Method::AccessibilityVoiceGuidanceSettings, "Accessibility.voiceGuidanceSettings"},
+    {Method::ActionsIntent, "Actions.intent"},
+    {Method::ActionsOnIntent, "Actions.onIntent"},
+    {Method::AdvertisingAdvertisingId, "Advertising.advertisingId"},
+    {Method::DeviceChipsetId, "Device.chipsetId"},
+    {Method::DeviceDeviceClass, "Device.deviceClass"},
+    {Method::DeviceHdr, "Device.hdr"},
+    {Method::DeviceOnHdrChanged, "Device.onHdrChanged"},
+    {Method::DeviceTimeInActiveState, "Device.timeInActiveState"},
+    {Method::DeviceUid, "Device.uid"},
+    {Method::DeviceUptime, "Device.uptime"},
+    {Method::DiscoveryWatched, "Discovery.watched"},
+    {Method::DiscoveryWatchedV2, "Discovery.watchedV2"},
+    {Method::DisplayEdid, "Display.edid"},
+    {Method::DisplayMaxResolution, "Display.maxResolution"},
+    {Method::DisplaySize, "Display.size"},
+    {Method::Lifecycle2Close, "Lifecycle2.close"},
+    {Method::Lifecycle2OnStateChanged, "Lifecycle2.onStateChanged"},
+    {Method::Lifecycle2State, "Lifecycle2.state"},
+    {Method::LocalizationCountry, "Localization.country"},
+    {Method::LocalizationOnCountryChanged, "Localization.onCountryChanged"},
+    {Method::LocalizationOnPreferredAudioLanguagesChanged, "Localization.onPreferredAudioLanguagesChanged"},
+    {Method::LocalizationOnPresentationLanguageChanged, "Localization.onPresentationLanguageChanged"},
+    {Method::LocalizationPreferredAudioLanguages, "Localization.preferredAudioLanguages"},
+    {Method::LocalizationPresentationLanguage, "Localization.presentationLanguage"},
+    {Method::MetricsAppInfo, "Metrics.appInfo"},
+    {Method::MetricsError, "Metrics.error"},
+    {Method::MetricsEvent, "Metrics.event"},
+    {Method::MetricsMediaEnded, "Metrics.mediaEnded"},
+    {Method::MetricsMediaLoadStart, "Metrics.mediaLoadStart"},
+    {Method::MetricsMediaPause, "Metrics.mediaPause"},
+    {Method::MetricsMediaPlay, "Metrics.mediaPlay"},
+    {Method::MetricsMediaPlaying, "Metrics.mediaPlaying"},
+    {Method::MetricsMediaRateChanged, "Metrics.mediaRateChanged"},
+    {Method::MetricsMediaRenditionChanged, "Metrics.mediaRenditionChanged"},
+    {Method::MetricsMediaSeeked, "Metrics.mediaSeeked"},
+    {Method::MetricsMediaSeeking, "Metrics.mediaSeeking"},
+    {Method::MetricsMediaWaiting, "Metrics.mediaWaiting"},
+    {Method::MetricsPage, "Metrics.page"},
+    {Method::MetricsReady, "Metrics.ready"},
+    {Method::MetricsSignIn, "Metrics.signIn"},
+    {Method::MetricsSignOut, "Metrics.signOut"},
+    {Method::MetricsStartContent, "Metrics.startContent"},
+    {Method::MetricsStopContent, "Metrics.stopContent"},
+    {Method::NetworkConnected, "Network.connected"},
+    {Method::NetworkOnConnectedChanged, "Network.onConnectedChanged"},
+    {Method::PresentationFocused, "Presentation.focused"},
+    {Method::PresentationOnFocusedChanged, "Presentation.onFocusedChanged"},
+    {Method::StatsMemoryUsage, "Stats.memoryUsage"},
+    {Method::TextToSpeechCancel, "TextToSpeech.cancel"},
+    {Method::TextToSpeechGetspeechstate, "TextToSpeech.getspeechstate"},
+    {Method::TextToSpeechListvoices, "TextToSpeech.listvoices"},
+    {Method::TextToSpeechOnNetworkerror, "TextToSpeech.onNetworkerror"},
+    {Method::TextToSpeechOnPlaybackerror, "TextToSpeech.onPlaybackerror"},
+    {Method::TextToSpeechOnSpeechcomplete, "TextToSpeech.onSpeechcomplete"},
+    {Method::TextToSpeechOnSpeechinterrupted, "TextToSpeech.onSpeechinterrupted"},
+    {Method::TextToSpeechOnSpeechpause, "TextToSpeech.onSpeechpause"},
+    {Method::TextToSpeechOnSpeechresume, "TextToSpeech.onSpeechresume"},
+    {Method::TextToSpeechOnSpeechstart, "TextToSpeech.onSpeechstart"},
+    {Method::TextToSpeechOnWillspeak, "TextToSpeech.onWillspeak"},
+    {Method::TextToSpeechPause, "TextToSpeech.pause"},
+    {Method::TextToSpeechResume, "TextToSpeech.resume"},
+    {Method::TextToSpeechSpeak, "TextToSpeech.speak"},
+});
+
+/**
+ * @return The name of method, e.g. "Metrics.mediaPlaying", as a string that lives as long as the program
+ */
+const std::string& methodName(Method method);
+} // namespace Firebolt::Internal
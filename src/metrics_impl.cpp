@@ -17,244 +17,312 @@
  */
 
 #include "metrics_impl.h"
+#include "json_decode.h"
 #include "json_types/common.h"
 #include "json_types/metrics.h"
+#include "json_writer.h"
 #include <firebolt/json_types.h>
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Metrics
 {
+namespace
+{
+std::optional<std::string_view> agePolicyName(const std::optional<Firebolt::AgePolicy>& agePolicy)
+{
+    if (agePolicy)
+    {
+        return Firebolt::JsonData::AgePolicyEnum.name(*agePolicy);
+    }
+    return std::nullopt;
+}
+} // namespace
+
 MetricsImpl::MetricsImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper)
 {
 }
 
+MetricsImpl::~MetricsImpl()
+{
+    if (auto outbox = std::atomic_load(&outbox_))
+    {
+        outbox->waitForReplay();
+    }
+    if (retiring_.joinable())
+    {
+        retiring_.join();
+    }
+}
+
+template <typename Write>
+Result<void> MetricsImpl::send(Method method, std::string_view entityId, Write&& write) const
+{
+    // IHelper only takes a DOM, so queued calls build it here as well: writing them as text would only
+    // move the work to a parse on the sender thread
+    Firebolt::Internal::JsonDomWriter parameters;
+    write(parameters);
+    if (auto sender = std::atomic_load(&sender_))
+    {
+        return sender->enqueue(method, entityId, std::move(parameters).finish());
+    }
+    return deliver(method, parameters.finish());
+}
+
 Result<void> MetricsImpl::ready() const
 {
-    return helper_.invoke("Metrics.ready", nlohmann::json());
+    return send(Method::MetricsReady, {}, [](auto& /*parameters*/) {});
 }
 
 Result<void> MetricsImpl::signIn() const
 {
-    return helper_.invoke("Metrics.signIn", nlohmann::json());
+    return send(Method::MetricsSignIn, {}, [](auto& /*parameters*/) {});
 }
 
 Result<void> MetricsImpl::signOut() const
 {
-    return helper_.invoke("Metrics.signOut", nlohmann::json());
+    return send(Method::MetricsSignOut, {}, [](auto& /*parameters*/) {});
 }
 
 Result<void> MetricsImpl::startContent(const std::optional<std::string>& entityId,
                                        const std::optional<Firebolt::AgePolicy> agePolicy) const
 {
-    nlohmann::json parameters;
-    if (entityId)
-    {
-        parameters["entityId"] = *entityId;
-    }
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.startContent", parameters);
+    return send(Method::MetricsStartContent, {},
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::stopContent(const std::optional<std::string>& entityId,
                                       const std::optional<Firebolt::AgePolicy> agePolicy) const
 {
-    nlohmann::json parameters;
-    if (entityId)
-    {
-        parameters["entityId"] = *entityId;
-    }
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.stopContent", parameters);
+    return send(Method::MetricsStopContent, {},
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::page(const std::string& pageId, const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["pageId"] = pageId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.page", parameters);
+    return send(Method::MetricsPage, {},
+                [&](auto& parameters)
+                {
+                    parameters.field("pageId", pageId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::error(const ErrorType type, const std::string& code, const std::string& description,
                                 const bool visible, const std::optional<std::map<std::string, std::string>>& parameters,
                                 const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json jsonParameters;
-    jsonParameters["type"] = Firebolt::JSON::toString(JsonData::ErrorTypeEnum, type);
-    jsonParameters["code"] = code;
-    jsonParameters["description"] = description;
-    jsonParameters["visible"] = visible;
-    if (parameters)
-    {
-        nlohmann::json paramString = nlohmann::json::object();
-        for (const auto& param : *parameters)
-        {
-            paramString[param.first] = param.second;
-        }
-        jsonParameters["parameters"] = paramString;
-    }
-    if (agePolicy)
-    {
-        jsonParameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.error", jsonParameters);
+    return send(Method::MetricsError, {},
+                [&](auto& jsonParameters)
+                {
+                    jsonParameters.field("type", JsonData::ErrorTypeEnum.name(type));
+                    jsonParameters.field("code", code);
+                    jsonParameters.field("description", description);
+                    jsonParameters.field("visible", visible);
+                    jsonParameters.field("parameters", parameters);
+                    jsonParameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaLoadStart(const std::string& entityId,
                                          const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaLoadStart", parameters);
+    return send(Method::MetricsMediaLoadStart, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaPlay(const std::string& entityId, const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaPlay", parameters);
+    return send(Method::MetricsMediaPlay, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaPlaying(const std::string& entityId,
                                        const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaPlaying", parameters);
+    return send(Method::MetricsMediaPlaying, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaPause(const std::string& entityId, const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaPause", parameters);
+    return send(Method::MetricsMediaPause, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaWaiting(const std::string& entityId,
                                        const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaWaiting", parameters);
+    return send(Method::MetricsMediaWaiting, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaSeeking(const std::string& entityId, const double target,
                                        const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    parameters["target"] = target;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaSeeking", parameters);
+    return send(Method::MetricsMediaSeeking, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("target", target);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaSeeked(const std::string& entityId, const double position,
                                       const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    parameters["position"] = position;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaSeeked", parameters);
+    return send(Method::MetricsMediaSeeked, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("position", position);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaRateChanged(const std::string& entityId, const double rate,
                                            const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    parameters["rate"] = rate;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaRateChanged", parameters);
+    return send(Method::MetricsMediaRateChanged, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("rate", rate);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaRenditionChanged(const std::string& entityId, const unsigned bitrate, const unsigned width,
                                                 const unsigned height, const std::optional<std::string>& profile,
                                                 const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    parameters["bitrate"] = bitrate;
-    parameters["width"] = width;
-    parameters["height"] = height;
-    if (profile)
-    {
-        parameters["profile"] = *profile;
-    }
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaRenditionChanged", parameters);
+    return send(Method::MetricsMediaRenditionChanged, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("bitrate", bitrate);
+                    parameters.field("width", width);
+                    parameters.field("height", height);
+                    parameters.field("profile", profile);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::mediaEnded(const std::string& entityId, const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["entityId"] = entityId;
-    if (agePolicy)
-    {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
-    }
-    return helper_.invoke("Metrics.mediaEnded", parameters);
+    return send(Method::MetricsMediaEnded, entityId,
+                [&](auto& parameters)
+                {
+                    parameters.field("entityId", entityId);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
 }
 
 Result<void> MetricsImpl::event(const std::string& schema, const std::string& data,
                                 const std::optional<Firebolt::AgePolicy>& agePolicy) const
 {
-    nlohmann::json parameters;
-    parameters["schema"] = schema;
-    parameters["data"] = data;
-    if (agePolicy)
+    return send(Method::MetricsEvent, {},
+                [&](auto& parameters)
+                {
+                    parameters.field("schema", schema);
+                    parameters.field("data", data);
+                    parameters.field("agePolicy", agePolicyName(agePolicy));
+                });
+}
+
+Result<void> MetricsImpl::appInfo(const std::string& build) const
+{
+    return send(Method::MetricsAppInfo, {}, [&](auto& parameters) { parameters.field("build", build); });
+}
+
+void MetricsImpl::configure(const ClientOptions& options)
+{
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox;
+    if (!options.outboxDirectory.empty())
+    {
+        outbox = Firebolt::Internal::Outbox::open(options.outboxDirectory + "/metrics.outbox", options.outboxSize);
+    }
+    std::atomic_store(&outbox_, std::move(outbox));
+
+    std::shared_ptr<MetricsSender> current = std::atomic_load(&sender_);
+    if (options.metricsQueue && current && current->matches(options))
+    {
+        // Reconnecting with the same queue keeps the sender and whatever it holds
+        current->setErrorCallback(options.onMetricsError);
+        return;
+    }
+    std::shared_ptr<MetricsSender> sender;
+    if (options.metricsQueue)
     {
-        parameters["agePolicy"] = Firebolt::JSON::toString(Firebolt::JsonData::AgePolicyEnum, *agePolicy);
+        sender = std::make_shared<MetricsSender>([this](Method method, const nlohmann::json& parameters)
+                                                 { return deliver(method, parameters); },
+                                                 options);
+    }
+    std::atomic_store(&sender_, std::move(sender));
+    if (current)
+    {
+        // The previous sender sends what it still holds once the last call using it returned, which must
+        // not hold up the caller, typically Connect()
+        if (retiring_.joinable())
+        {
+            retiring_.join();
+        }
+        retiring_ = std::thread([previous = std::move(current)]() mutable { previous.reset(); });
     }
-    return helper_.invoke("Metrics.event", parameters);
 }
 
-Result<void> MetricsImpl::appInfo(const std::string& build) const
+void MetricsImpl::onConnectionChanged(bool connected)
+{
+    auto outbox = std::atomic_load(&outbox_);
+    if (!connected || !outbox)
+    {
+        connected_.store(connected);
+        return;
+    }
+    outbox->replay([this](const std::string& method, const nlohmann::json& parameters)
+                   { return helper_.invoke(method, parameters); });
+    connected_.store(true);
+}
+
+Result<void> MetricsImpl::deliver(Method method, const nlohmann::json& parameters) const
 {
-    nlohmann::json parameters;
-    parameters["build"] = build;
-    return helper_.invoke("Metrics.appInfo", parameters);
+    auto outbox = std::atomic_load(&outbox_);
+    if (!outbox)
+    {
+        return Firebolt::Internal::invoke(helper_, method, parameters);
+    }
+    return outbox->deliver(Firebolt::Internal::MethodNames[method], parameters, connected_.load(),
+                           [&] { return Firebolt::Internal::invoke(helper_, method, parameters); });
 }
 
 } // namespace Firebolt::Metrics
@@ -18,8 +18,15 @@
 
 #pragma once
 
+#include "firebolt/client_options.h"
 #include "firebolt/metrics.h"
+#include "metrics_sender.h"
+#include "outbox.h"
+#include <atomic>
 #include <firebolt/helpers.h>
+#include <memory>
+#include <string_view>
+#include <thread>
 
 namespace Firebolt::Metrics
 {
@@ -30,7 +37,7 @@ public:
     MetricsImpl(const MetricsImpl&) = delete;
     MetricsImpl& operator=(const MetricsImpl&) = delete;
 
-    ~MetricsImpl() override = default;
+    ~MetricsImpl() override;
 
     Result<void> ready() const override;
     Result<void> signIn() const override;
@@ -68,7 +75,24 @@ public:
                        const std::optional<Firebolt::AgePolicy>& agePolicy) const override;
     Result<void> appInfo(const std::string& build) const override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
+private:
+    template <typename Write>
+    Result<void> send(Firebolt::Internal::Method method, std::string_view entityId, Write&& write) const;
+    Result<void> deliver(Firebolt::Internal::Method method, const nlohmann::json& parameters) const;
+
 private:
     Firebolt::Helpers::IHelper& helper_;
+
+    std::atomic<bool> connected_{true};
+    // Set while enabled by ClientOptions, accessed with std::atomic_load/atomic_store.
+    // Destroying the sender sends its remaining calls through deliver(), so everything deliver() touches is
+    // declared before it
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox_;
+    std::shared_ptr<MetricsSender> sender_;
+    // Sends what a replaced sender still holds, off the thread reconfiguring
+    std::thread retiring_;
 };
 } // namespace Firebolt::Metrics
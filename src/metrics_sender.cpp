@@ -0,0 +1,216 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics_sender.h"
+#include <algorithm>
+#include <string_view>
+
+using Firebolt::Internal::Method;
+
+namespace Firebolt::Metrics
+{
+namespace
+{
+enum class Redundancy
+{
+    None,
+    KeepFirst,
+    KeepLast,
+};
+
+Redundancy redundancyOf(Method method)
+{
+    switch (method)
+    {
+    case Method::MetricsMediaPlaying:
+    case Method::MetricsMediaWaiting:
+    case Method::MetricsMediaPause:
+    case Method::MetricsMediaPlay:
+        return Redundancy::KeepFirst;
+    case Method::MetricsMediaRateChanged:
+    case Method::MetricsMediaRenditionChanged:
+        return Redundancy::KeepLast;
+    default:
+        return Redundancy::None;
+    }
+}
+
+std::size_t coalesceLimitOf(const ClientOptions& options)
+{
+    return options.metricsCoalesce ? std::max<std::size_t>(options.metricsCoalesceLimit, 1) : 1;
+}
+
+std::chrono::milliseconds coalesceDelayOf(const ClientOptions& options)
+{
+    return options.metricsCoalesce ? options.metricsCoalesceDelay : std::chrono::milliseconds(0);
+}
+} // namespace
+
+MetricsSender::MetricsSender(Send send, const ClientOptions& options)
+    : send_(std::move(send)),
+      queue_(options.metricsQueueCapacity),
+      onError_(std::make_shared<const ClientOptions::MetricsErrorCallback>(options.onMetricsError)),
+      capacity_(options.metricsQueueCapacity),
+      coalesceDelay_(coalesceDelayOf(options)),
+      coalesceLimit_(coalesceLimitOf(options)),
+      drainTimeout_(options.metricsDrainTimeout),
+      thread_([this] { run(); })
+{
+}
+
+MetricsSender::~MetricsSender()
+{
+    {
+        std::lock_guard lock{mutex_};
+        drainDeadline_ = std::chrono::steady_clock::now() + drainTimeout_;
+        stopping_.store(true);
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+Result<void> MetricsSender::enqueue(Method method, std::string_view entityId, nlohmann::json parameters)
+{
+    Call call{method, std::string(entityId), std::move(parameters)};
+    if (!queue_.push(std::move(call)))
+    {
+        return Result<void>{Firebolt::Error::General};
+    }
+    // Pairs with the fence in wait(): either the sender sees the call or this sees it going to sleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load())
+    {
+        // Taking the mutex orders the notification after the sender blocked, so it is not lost
+        std::lock_guard lock{mutex_};
+        cv_.notify_one();
+    }
+    return Result<void>{Firebolt::Error::None};
+}
+
+bool MetricsSender::matches(const ClientOptions& options) const
+{
+    return capacity_ == options.metricsQueueCapacity && coalesceDelay_ == coalesceDelayOf(options) &&
+           coalesceLimit_ == coalesceLimitOf(options) && drainTimeout_ == options.metricsDrainTimeout;
+}
+
+void MetricsSender::setErrorCallback(ClientOptions::MetricsErrorCallback onError)
+{
+    std::atomic_store(&onError_, std::make_shared<const ClientOptions::MetricsErrorCallback>(std::move(onError)));
+}
+
+void MetricsSender::coalesce(std::vector<Call>& calls)
+{
+    // Compacts in place, the dropped calls end up past the kept ones
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < calls.size(); ++i)
+    {
+        Call& call = calls[i];
+        if (kept > 0 && !call.entityId.empty() && calls[kept - 1].method == call.method &&
+            calls[kept - 1].entityId == call.entityId)
+        {
+            Redundancy redundancy = redundancyOf(call.method);
+            if (redundancy == Redundancy::KeepFirst)
+            {
+                continue;
+            }
+            if (redundancy == Redundancy::KeepLast)
+            {
+                std::swap(calls[kept - 1], call);
+                continue;
+            }
+        }
+        if (kept != i)
+        {
+            std::swap(calls[kept], call);
+        }
+        ++kept;
+    }
+    calls.resize(kept);
+}
+
+void MetricsSender::run()
+{
+    std::vector<Call> calls;
+    while (true)
+    {
+        auto call = queue_.pop();
+        if (!call)
+        {
+            if (stopping_.load() && queue_.empty())
+            {
+                return;
+            }
+            wait(std::nullopt);
+            continue;
+        }
+
+        calls.push_back(std::move(*call));
+        auto deadline = std::chrono::steady_clock::now() + coalesceDelay_;
+        while (calls.size() < coalesceLimit_)
+        {
+            if (auto next = queue_.pop())
+            {
+                calls.push_back(std::move(*next));
+            }
+            else if (std::chrono::steady_clock::now() >= deadline || !wait(deadline))
+            {
+                break;
+            }
+        }
+        if (calls.size() > 1)
+        {
+            coalesce(calls);
+        }
+
+        for (auto& pending : calls)
+        {
+            // Past the drain deadline, the calls left are reported instead of holding up the destructor
+            bool expired = stopping_.load() && std::chrono::steady_clock::now() >= drainDeadline_;
+            Result<void> result =
+                expired ? Result<void>{Firebolt::Error::Timedout} : send_(pending.method, pending.parameters);
+            if (!result)
+            {
+                auto onError = std::atomic_load(&onError_);
+                if (*onError)
+                {
+                    (*onError)(Firebolt::Internal::methodName(pending.method), result.error());
+                }
+            }
+        }
+        calls.clear();
+    }
+}
+
+bool MetricsSender::wait(std::optional<std::chrono::steady_clock::time_point> deadline)
+{
+    std::unique_lock lock{mutex_};
+    sleeping_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto woken = [this] { return stopping_.load() || !queue_.empty(); };
+    if (deadline)
+    {
+        cv_.wait_until(lock, *deadline, woken);
+    }
+    else
+    {
+        cv_.wait(lock, woken);
+    }
+    sleeping_.store(false);
+    return !stopping_.load();
+}
+} // namespace Firebolt::Metrics
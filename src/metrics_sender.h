@@ -0,0 +1,109 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "bounded_queue.h"
+#include "firebolt/client_options.h"
+#include "methods.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <firebolt/types.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Firebolt::Metrics
+{
+/**
+ * @brief Background sender for fire-and-forget Metrics calls
+ *
+ * enqueue() only moves the call into a bounded lock-free queue and returns; a dedicated thread
+ * drains the queue and performs the calls, sleeping while it is empty until the next call arrives.
+ * Failed calls are reported to the error callback.
+ * With coalescing, the thread gathers the calls already queued, and those arriving within the coalescing delay,
+ * up to the coalescing limit, and drops the redundant ones before sending them one by one. On destruction, the
+ * thread keeps sending the calls still queued until the drain timeout, then reports the rest to the error callback
+ * with Error::Timedout, so dropping the sender waits at most that long plus one call.
+ */
+class MetricsSender
+{
+public:
+    struct Call
+    {
+        Firebolt::Internal::Method method;
+        std::string entityId;
+        nlohmann::json parameters;
+    };
+
+    using Send = std::function<Result<void>(Firebolt::Internal::Method method, const nlohmann::json& parameters)>;
+
+    MetricsSender(Send send, const ClientOptions& options);
+    MetricsSender(const MetricsSender&) = delete;
+    MetricsSender& operator=(const MetricsSender&) = delete;
+    ~MetricsSender();
+
+    /**
+     * @brief Queues a call, fails with Error::General if the queue is full
+     */
+    Result<void> enqueue(Firebolt::Internal::Method method, std::string_view entityId, nlohmann::json parameters);
+
+    /**
+     * @brief Whether the queue and coalescing of this sender are those options ask for
+     */
+    bool matches(const ClientOptions& options) const;
+
+    void setErrorCallback(ClientOptions::MetricsErrorCallback onError);
+
+    /**
+     * @brief Drops redundant consecutive calls for the same entity: a repeated media state event
+     *        (e.g. mediaPlaying) is kept once, of a run of rate or rendition changes only the last is kept
+     */
+    static void coalesce(std::vector<Call>& calls);
+
+private:
+    void run();
+    // Waits for a call or until the deadline, if any; returns false once stopping
+    bool wait(std::optional<std::chrono::steady_clock::time_point> deadline);
+
+private:
+    const Send send_;
+    Firebolt::Internal::BoundedQueue<Call> queue_;
+    // Accessed with std::atomic_load/atomic_store
+    std::shared_ptr<const ClientOptions::MetricsErrorCallback> onError_;
+    const std::size_t capacity_;
+    const std::chrono::milliseconds coalesceDelay_;
+    const std::size_t coalesceLimit_;
+    const std::chrono::milliseconds drainTimeout_;
+    // Set by the destructor before stopping_
+    std::chrono::steady_clock::time_point drainDeadline_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+};
+} // namespace Firebolt::Metrics
@@ -19,22 +19,26 @@
 #include "network_impl.h"
 #include <firebolt/json_types.h>
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Network
 {
 NetworkImpl::NetworkImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper),
-      subscriptionManager_(helper, this)
+      subscriptionManager_(helper, this),
+      connected_(helper, Method::NetworkConnected, Method::NetworkOnConnectedChanged)
 {
 }
 
 Result<bool> NetworkImpl::connected() const
 {
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Network.connected");
+    return connected_.get();
 }
 
 Result<SubscriptionId> NetworkImpl::subscribeOnConnectedChanged(std::function<void(bool)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean>("Network.onConnectedChanged", std::move(notification));
+    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean>(Method::NetworkOnConnectedChanged,
+                                                                   std::move(notification));
 }
 
 Result<void> NetworkImpl::unsubscribe(SubscriptionId id)
@@ -46,4 +50,14 @@ void NetworkImpl::unsubscribeAll()
 {
     subscriptionManager_.unsubscribeAll();
 }
+
+void NetworkImpl::configure(const ClientOptions& options)
+{
+    connected_.setEnabled(options.propertyCache);
+}
+
+void NetworkImpl::onConnectionChanged(bool /*connected*/)
+{
+    connected_.invalidate();
+}
 } // namespace Firebolt::Network
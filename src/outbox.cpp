@@ -0,0 +1,444 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "outbox.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Firebolt::Internal
+{
+namespace
+{
+constexpr uint32_t Magic = 0x584f4246; // "FBOX"
+constexpr uint32_t Version = 1;
+constexpr std::size_t ReplayBatch = 16;
+constexpr uint32_t WrapMarker = 0;
+} // namespace
+
+/**
+ * File layout: this header, followed by the ring of records. A record is its 32-bit length followed by
+ * the method name, a '\0' and the parameters as JSON text. A zero length, or less than four bytes left
+ * before the end of the ring, means the next record is at the start of the ring.
+ */
+struct Outbox::Header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t used;
+    uint64_t firstSequence;
+    uint64_t count;
+};
+
+std::shared_ptr<Outbox> Outbox::open(const std::string& path, std::size_t size)
+{
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<Outbox>> outboxes;
+
+    std::lock_guard lock{mutex};
+    for (auto it = outboxes.begin(); it != outboxes.end();)
+    {
+        it = it->second.expired() ? outboxes.erase(it) : std::next(it);
+    }
+    std::weak_ptr<Outbox>& entry = outboxes[path];
+    std::shared_ptr<Outbox> outbox = entry.lock();
+    if (!outbox)
+    {
+        outbox = std::make_shared<Outbox>(path, size);
+        if (!outbox->isOpen())
+        {
+            outboxes.erase(path);
+            return nullptr;
+        }
+        entry = outbox;
+    }
+    return outbox;
+}
+
+Outbox::Outbox(const std::string& path, std::size_t size)
+{
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        return;
+    }
+    // Held until the file is closed, so that another process cannot map the same ring
+    if (::flock(fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        ::close(fd);
+        return;
+    }
+    std::size_t mappedSize = sizeof(Header) + std::max<std::size_t>(size, 1024);
+    struct stat info = {};
+    bool resized = ::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) != mappedSize;
+    if (resized && ::ftruncate(fd, static_cast<off_t>(mappedSize)) != 0)
+    {
+        ::close(fd);
+        return;
+    }
+    void* data = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        ::close(fd);
+        return;
+    }
+    fd_ = fd;
+    data_ = static_cast<uint8_t*>(data);
+    mappedSize_ = mappedSize;
+
+    Header& h = header();
+    uint64_t capacity = mappedSize - sizeof(Header);
+    if (resized || h.magic != Magic || h.version != Version || h.capacity != capacity || h.head > capacity ||
+        h.tail > capacity || h.used > capacity)
+    {
+        h = Header{Magic, Version, capacity, 0, 0, 0, 0, 0};
+    }
+    // A record ending exactly at the end of the ring leaves nothing to skip to reach its start
+    if (h.tail == capacity)
+    {
+        h.tail = 0;
+    }
+    if (h.head == capacity)
+    {
+        h.head = 0;
+    }
+}
+
+Outbox::~Outbox()
+{
+    waitForReplay();
+    if (data_)
+    {
+        ::munmap(data_, mappedSize_);
+        ::close(fd_);
+    }
+}
+
+Outbox::Header& Outbox::header() const
+{
+    return *reinterpret_cast<Header*>(data_);
+}
+
+Result<void> Outbox::deliver(std::string_view method, const nlohmann::json& parameters, bool connected,
+                             const Invoke& invoke)
+{
+    if (connected ? appendIfReplaying(method, parameters) : append(method, parameters))
+    {
+        return Result<void>{Firebolt::Error::None};
+    }
+    Result<void> result = invoke();
+    if (!result && isUndelivered(result.error()) && append(method, parameters))
+    {
+        return Result<void>{Firebolt::Error::None};
+    }
+    return result;
+}
+
+bool Outbox::append(std::string_view method, const nlohmann::json& parameters)
+{
+    return append(method, std::string_view(parameters.dump()));
+}
+
+bool Outbox::append(std::string_view method, std::string_view parameters)
+{
+    std::lock_guard lock{mutex_};
+    return appendLocked(method, parameters);
+}
+
+bool Outbox::appendIfReplaying(std::string_view method, const nlohmann::json& parameters)
+{
+    return replaying_.load() && appendIfReplaying(method, std::string_view(parameters.dump()));
+}
+
+bool Outbox::appendIfReplaying(std::string_view method, std::string_view parameters)
+{
+    if (!replaying_.load())
+    {
+        return false;
+    }
+    std::lock_guard lock{mutex_};
+    return replaying_.load() && appendLocked(method, parameters);
+}
+
+bool Outbox::appendLocked(std::string_view method, std::string_view parameters)
+{
+    if (!data_)
+    {
+        return false;
+    }
+
+    Header& h = header();
+    uint8_t* ring = data_ + sizeof(Header);
+    uint64_t recordSize = method.size() + 1 + parameters.size();
+    uint64_t needed = sizeof(uint32_t) + recordSize;
+    if (needed > h.capacity / 2)
+    {
+        return false;
+    }
+
+    while (true)
+    {
+        if (h.used == 0)
+        {
+            h.head = h.tail = 0;
+        }
+        bool wrapped = h.tail < h.head || (h.tail == h.head && h.used > 0);
+        if (!wrapped)
+        {
+            if (h.tail + needed <= h.capacity)
+            {
+                break;
+            }
+            if (h.tail + sizeof(uint32_t) <= h.capacity)
+            {
+                std::memcpy(ring + h.tail, &WrapMarker, sizeof(uint32_t));
+            }
+            h.used += h.capacity - h.tail;
+            h.tail = 0;
+        }
+        else if (h.tail + needed <= h.head)
+        {
+            break;
+        }
+        else
+        {
+            dropOldest();
+        }
+    }
+
+    uint32_t length = static_cast<uint32_t>(recordSize);
+    uint8_t* record = ring + h.tail + sizeof(length);
+    std::memcpy(ring + h.tail, &length, sizeof(length));
+    std::memcpy(record, method.data(), method.size());
+    record[method.size()] = '\0';
+    std::memcpy(record + method.size() + 1, parameters.data(), parameters.size());
+    // The record is complete before the header refers to it
+    std::atomic_thread_fence(std::memory_order_release);
+    h.tail += needed;
+    h.used += needed;
+    ++h.count;
+    ::msync(data_, mappedSize_, MS_ASYNC);
+    return true;
+}
+
+uint64_t Outbox::sequence() const
+{
+    std::lock_guard lock{mutex_};
+    return header().firstSequence;
+}
+
+std::size_t Outbox::size() const
+{
+    if (!data_)
+    {
+        return 0;
+    }
+    std::lock_guard lock{mutex_};
+    return header().count;
+}
+
+void Outbox::dropOldest()
+{
+    Header& h = header();
+    const uint8_t* ring = data_ + sizeof(Header);
+    while (h.used > 0)
+    {
+        uint32_t length = WrapMarker;
+        if (h.head + sizeof(uint32_t) <= h.capacity)
+        {
+            std::memcpy(&length, ring + h.head, sizeof(length));
+        }
+        if (length == WrapMarker)
+        {
+            h.used -= h.capacity - h.head;
+            h.head = 0;
+            continue;
+        }
+        if (h.head + sizeof(uint32_t) + length > h.capacity)
+        {
+            discardAll();
+            return;
+        }
+        h.head += sizeof(uint32_t) + length;
+        h.used -= sizeof(uint32_t) + length;
+        ++h.firstSequence;
+        --h.count;
+        return;
+    }
+}
+
+void Outbox::discardAll()
+{
+    // Corrupted, e.g. by a record torn in a crash, start over
+    Header& h = header();
+    discarded_ += h.count;
+    h = Header{Magic, Version, h.capacity, 0, 0, 0, h.firstSequence + h.count, 0};
+}
+
+uint64_t Outbox::peek(std::size_t count, std::vector<Record>& records)
+{
+    Header& h = header();
+    const uint8_t* ring = data_ + sizeof(Header);
+    uint64_t position = h.head;
+    uint64_t remaining = h.used;
+    while (remaining > 0 && records.size() < count)
+    {
+        uint32_t length = WrapMarker;
+        if (position + sizeof(uint32_t) <= h.capacity)
+        {
+            std::memcpy(&length, ring + position, sizeof(length));
+        }
+        if (length == WrapMarker)
+        {
+            remaining -= h.capacity - position;
+            position = 0;
+            continue;
+        }
+        if (position + sizeof(uint32_t) + length > h.capacity)
+        {
+            // The records before it are still sent, the next call gets here with none
+            if (records.empty())
+            {
+                discardAll();
+            }
+            break;
+        }
+        const char* text = reinterpret_cast<const char*>(ring + position + sizeof(uint32_t));
+        std::size_t methodLength = strnlen(text, length);
+        // Parameters that are missing or do not parse leave a discarded value, the record is dropped unsent
+        Record record{std::string(text, methodLength), nlohmann::json(nlohmann::json::value_t::discarded)};
+        if (methodLength < length)
+        {
+            record.parameters = nlohmann::json::parse(text + methodLength + 1, text + length, nullptr, false);
+        }
+        records.push_back(std::move(record));
+        position += sizeof(uint32_t) + length;
+        remaining -= sizeof(uint32_t) + length;
+    }
+    return h.firstSequence;
+}
+
+bool Outbox::flush(const Send& send)
+{
+    if (!data_)
+    {
+        return true;
+    }
+    while (true)
+    {
+        std::vector<Record> records;
+        uint64_t firstSequence;
+        {
+            std::lock_guard lock{mutex_};
+            firstSequence = peek(ReplayBatch, records);
+        }
+        if (records.empty())
+        {
+            return true;
+        }
+
+        std::size_t sent = 0;
+        bool undelivered = false;
+        for (const auto& record : records)
+        {
+            if (record.parameters.is_discarded())
+            {
+                ++discarded_;
+                ++sent;
+                continue;
+            }
+            Result<void> result = send(record.method, record.parameters);
+            if (!result && isUndelivered(result.error()))
+            {
+                undelivered = true;
+                break;
+            }
+            ++sent;
+        }
+
+        {
+            std::lock_guard lock{mutex_};
+            // Records dropped for room meanwhile are already gone
+            while (header().count > 0 && header().firstSequence < firstSequence + sent)
+            {
+                dropOldest();
+            }
+        }
+        if (undelivered)
+        {
+            return false;
+        }
+    }
+}
+
+void Outbox::replay(Send send)
+{
+    if (!data_ || replaying_.exchange(true))
+    {
+        return;
+    }
+    std::lock_guard lock{replayMutex_};
+    if (replayThread_.joinable())
+    {
+        replayThread_.join();
+    }
+    // Keeps the outbox alive while replaying, so whoever drops it never waits for the replay
+    replayThread_ = std::thread(
+        [self = shared_from_this(), send = std::move(send)]
+        {
+            while (true)
+            {
+                uint64_t firstSequence = self->sequence();
+                bool delivered = self->flush(send);
+                std::lock_guard lock{self->mutex_};
+                // Stops as well if a pass dropped nothing, rather than spinning on records it cannot send
+                if (!delivered || self->header().count == 0 || self->header().firstSequence == firstSequence)
+                {
+                    self->replaying_.store(false);
+                    return;
+                }
+            }
+        });
+}
+
+void Outbox::waitForReplay()
+{
+    std::lock_guard lock{replayMutex_};
+    if (!replayThread_.joinable())
+    {
+        return;
+    }
+    if (replayThread_.get_id() == std::this_thread::get_id())
+    {
+        // Released by the replay itself once done, it does not touch the outbox any more
+        replayThread_.detach();
+    }
+    else
+    {
+        replayThread_.join();
+    }
+}
+} // namespace Firebolt::Internal
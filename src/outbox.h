@@ -0,0 +1,152 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <firebolt/types.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Firebolt::Internal
+{
+/**
+ * @brief Durable store for calls that could not be delivered, replayed once connected again
+ *
+ * The calls are appended to a memory-mapped ring file of fixed size, so they survive a restart of the
+ * application. When the ring is full, the oldest calls are dropped to make room.
+ *
+ * Only one Outbox may map a file at a time, open() shares the one already open for a path, including its running
+ * replay when reconnecting. The file is locked with flock() while open, so opening it fails in any other process
+ * until this one closes it.
+ *
+ * Being shared, the outbox may outlive the owner of the Send its replay runs, so that owner calls waitForReplay()
+ * before it is destroyed. To keep the calls in order, the owner sends its calls through deliver(), which stores
+ * the calls made while a replay runs instead of sending them ahead of the stored ones.
+ */
+class Outbox : public std::enable_shared_from_this<Outbox>
+{
+public:
+    using Send = std::function<Result<void>(const std::string& method, const nlohmann::json& parameters)>;
+    using Invoke = std::function<Result<void>()>;
+
+    /**
+     * @brief The outbox of path, opened with size unless it is open already
+     * @return nullptr if the file cannot be opened
+     */
+    static std::shared_ptr<Outbox> open(const std::string& path, std::size_t size);
+
+    Outbox(const std::string& path, std::size_t size);
+    Outbox(const Outbox&) = delete;
+    Outbox& operator=(const Outbox&) = delete;
+    ~Outbox();
+
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief Whether a call that failed with this error should be kept for replay. A call that timed out may
+     *        have reached the platform already, so it is not kept: replaying it could deliver it twice.
+     */
+    static bool isUndelivered(Firebolt::Error error) { return error == Firebolt::Error::NotConnected; }
+
+    /**
+     * @brief Sends a call with invoke, or stores it for replay: while disconnected, while a replay is running,
+     *        or when invoke fails with an undelivered error
+     * @return Success for a stored call, so that the caller does not send it again, otherwise the result of invoke
+     */
+    Result<void> deliver(std::string_view method, const nlohmann::json& parameters, bool connected,
+                         const Invoke& invoke);
+
+    bool append(std::string_view method, const nlohmann::json& parameters);
+
+    /**
+     * @brief Same as append(method, parameters), with the parameters already serialized
+     */
+    bool append(std::string_view method, std::string_view parameters);
+
+    /**
+     * @brief Appends the call only while a replay is running, so that it is sent after the calls stored before it
+     * @return false if no replay is running, the call is then to be sent directly
+     */
+    bool appendIfReplaying(std::string_view method, const nlohmann::json& parameters);
+    bool appendIfReplaying(std::string_view method, std::string_view parameters);
+
+    std::size_t size() const;
+
+    /**
+     * @brief Number of stored calls dropped without sending because they could not be read back
+     */
+    std::size_t discarded() const { return discarded_.load(); }
+
+    /**
+     * @brief Sends the stored calls in order, a batch at a time, until none are left or one is undelivered.
+     *        Calls failing with any other error are dropped, as are calls that cannot be read back, see discarded().
+     * @return false if it stopped at an undelivered call
+     */
+    bool flush(const Send& send);
+
+    /**
+     * @brief Same as flush(), on a background thread, until calls appended meanwhile are sent as well.
+     *        Does nothing while a replay is still running. The outbox must be owned by a std::shared_ptr.
+     */
+    void replay(Send send);
+
+    /**
+     * @brief Waits for the running replay, so that its Send may be destroyed
+     */
+    void waitForReplay();
+
+private:
+    struct Header;
+    struct Record
+    {
+        std::string method;
+        nlohmann::json parameters;
+    };
+
+    Header& header() const;
+    bool appendLocked(std::string_view method, std::string_view parameters);
+    // Copies up to count records from the oldest on, returns the sequence number of the first
+    uint64_t peek(std::size_t count, std::vector<Record>& records);
+    void dropOldest();
+    // Drops every record, counting them as discarded
+    void discardAll();
+    uint64_t sequence() const;
+
+private:
+    mutable std::mutex mutex_;
+    // Kept open for its lock
+    int fd_ = -1;
+    uint8_t* data_ = nullptr;
+    std::size_t mappedSize_ = 0;
+
+    std::mutex replayMutex_;
+    // Cleared under mutex_, so no call is appended for a replay that already ended
+    std::atomic<bool> replaying_{false};
+    std::thread replayThread_;
+    std::atomic<std::size_t> discarded_{0};
+};
+} // namespace Firebolt::Internal
@@ -19,22 +19,25 @@
 #include "presentation_impl.h"
 #include <firebolt/json_types.h>
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::Presentation
 {
 PresentationImpl::PresentationImpl(Firebolt::Helpers::IHelper& helper)
     : helper_(helper),
-      subscriptionManager_(helper, this)
+      subscriptionManager_(helper, this),
+      focused_(helper, Method::PresentationFocused, Method::PresentationOnFocusedChanged)
 {
 }
 
 Result<bool> PresentationImpl::focused() const
 {
-    return helper_.get<Firebolt::JSON::Boolean, bool>("Presentation.focused");
+    return focused_.get();
 }
 
 Result<SubscriptionId> PresentationImpl::subscribeOnFocusedChanged(std::function<void(bool)>&& notification)
 {
-    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean>("Presentation.onFocusedChanged",
+    return subscriptionManager_.subscribe<Firebolt::JSON::Boolean>(Method::PresentationOnFocusedChanged,
                                                                    std::move(notification));
 }
 
@@ -47,4 +50,14 @@ void PresentationImpl::unsubscribeAll()
 {
     subscriptionManager_.unsubscribeAll();
 }
+
+void PresentationImpl::configure(const ClientOptions& options)
+{
+    focused_.setEnabled(options.propertyCache);
+}
+
+void PresentationImpl::onConnectionChanged(bool /*connected*/)
+{
+    focused_.invalidate();
+}
 } // namespace Firebolt::Presentation
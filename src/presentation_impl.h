@@ -18,8 +18,12 @@
 
 #pragma once
 
+#include "cached_property.h"
+#include "firebolt/client_options.h"
 #include "firebolt/presentation.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
+#include <firebolt/json_types.h>
 
 namespace Firebolt::Presentation
 {
@@ -40,8 +44,13 @@ public:
     virtual Result<void> unsubscribe(SubscriptionId id) override;
     virtual void unsubscribeAll() override;
 
+    void configure(const ClientOptions& options);
+    void onConnectionChanged(bool connected);
+
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
+
+    mutable Firebolt::Internal::CachedProperty<Firebolt::JSON::Boolean, bool> focused_;
 };
 } // namespace Firebolt::Presentation
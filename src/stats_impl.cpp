@@ -23,6 +23,7 @@
 #include <string>
 
 using namespace Firebolt::Helpers;
+using Firebolt::Internal::Method;
 
 namespace Firebolt::Stats
 {
@@ -35,7 +36,7 @@ StatsImpl::~StatsImpl() {}
 
 Result<MemoryInfo> StatsImpl::memoryUsage() const
 {
-    return helper_.get<JsonData::MemoryInfo, MemoryInfo>("Stats.memoryUsage");
+    return Firebolt::Internal::get<JsonData::MemoryInfo, MemoryInfo>(helper_, Method::StatsMemoryUsage);
 }
 
 } // namespace Firebolt::Stats
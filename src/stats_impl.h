@@ -19,6 +19,7 @@
 #pragma once
 
 #include "firebolt/stats.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::Stats
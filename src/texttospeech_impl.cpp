@@ -19,6 +19,8 @@
 #include "texttospeech_impl.h"
 #include "json_types/texttospeech.h"
 
+using Firebolt::Internal::Method;
+
 namespace Firebolt::TextToSpeech
 {
 TextToSpeechImpl::TextToSpeechImpl(Firebolt::Helpers::IHelper& helper)
@@ -31,87 +33,96 @@ Result<ListVoicesResponse> TextToSpeechImpl::listVoices(const std::string& langu
 {
     nlohmann::json params;
     params["language"] = language;
-    return helper_.get<JsonData::ListVoicesResponse, ListVoicesResponse>("TextToSpeech.listvoices", params);
+    return Firebolt::Internal::get<JsonData::ListVoicesResponse, ListVoicesResponse>(
+        helper_, Method::TextToSpeechListvoices, params);
 }
 
 Result<SpeechResponse> TextToSpeechImpl::speak(const std::string& text) const
 {
     nlohmann::json params;
     params["text"] = text;
-    return helper_.get<JsonData::SpeechResponse, SpeechResponse>("TextToSpeech.speak", params);
+    return Firebolt::Internal::get<JsonData::SpeechResponse, SpeechResponse>(helper_, Method::TextToSpeechSpeak,
+                                                                             params);
 }
 
 Result<TTSStatusResponse> TextToSpeechImpl::pause(SpeechId speechId) const
 {
     nlohmann::json params;
     params["speechid"] = speechId;
-    return helper_.get<JsonData::TTSStatusResponse, TTSStatusResponse>("TextToSpeech.pause", params);
+    return Firebolt::Internal::get<JsonData::TTSStatusResponse, TTSStatusResponse>(helper_, Method::TextToSpeechPause,
+                                                                                   params);
 }
 
 Result<TTSStatusResponse> TextToSpeechImpl::resume(SpeechId speechId) const
 {
     nlohmann::json params;
     params["speechid"] = speechId;
-    return helper_.get<JsonData::TTSStatusResponse, TTSStatusResponse>("TextToSpeech.resume", params);
+    return Firebolt::Internal::get<JsonData::TTSStatusResponse, TTSStatusResponse>(helper_, Method::TextToSpeechResume,
+                                                                                   params);
 }
 
 Result<TTSStatusResponse> TextToSpeechImpl::cancel(SpeechId speechId) const
 {
     nlohmann::json params;
     params["speechid"] = speechId;
-    return helper_.get<JsonData::TTSStatusResponse, TTSStatusResponse>("TextToSpeech.cancel", params);
+    return Firebolt::Internal::get<JsonData::TTSStatusResponse, TTSStatusResponse>(helper_, Method::TextToSpeechCancel,
+                                                                                   params);
 }
 
 Result<SpeechStateResponse> TextToSpeechImpl::getSpeechState(SpeechId speechId) const
 {
     nlohmann::json params;
     params["speechid"] = speechId;
-    return helper_.get<JsonData::SpeechStateResponse, SpeechStateResponse>("TextToSpeech.getspeechstate", params);
+    return Firebolt::Internal::get<JsonData::SpeechStateResponse, SpeechStateResponse>(
+        helper_, Method::TextToSpeechGetspeechstate, params);
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnWillSpeak(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onWillspeak", std::move(notification));
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnWillspeak,
+                                                                   std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnSpeechStart(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onSpeechstart", std::move(notification));
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnSpeechstart,
+                                                                   std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnSpeechPause(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onSpeechpause", std::move(notification));
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnSpeechpause,
+                                                                   std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnSpeechResume(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onSpeechresume",
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnSpeechresume,
                                                                    std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnSpeechComplete(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onSpeechcomplete",
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnSpeechcomplete,
                                                                    std::move(notification));
 }
 
 Result<SubscriptionId>
 TextToSpeechImpl::subscribeOnSpeechInterrupted(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onSpeechinterrupted",
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnSpeechinterrupted,
                                                                    std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnNetworkError(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onNetworkerror",
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnNetworkerror,
                                                                    std::move(notification));
 }
 
 Result<SubscriptionId> TextToSpeechImpl::subscribeOnPlaybackError(std::function<void(const SpeechIdEvent&)>&& notification)
 {
-    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>("TextToSpeech.onPlaybackerror",
+    return subscriptionManager_.subscribe<JsonData::SpeechIdEvent>(Method::TextToSpeechOnPlaybackerror,
                                                                    std::move(notification));
 }
 
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "firebolt/texttospeech.h"
+#include "json_decode.h"
 #include <firebolt/helpers.h>
 
 namespace Firebolt::TextToSpeech
@@ -52,6 +53,6 @@ public:
 
 private:
     Firebolt::Helpers::IHelper& helper_;
-    Firebolt::Helpers::SubscriptionManager subscriptionManager_;
+    Firebolt::Internal::SubscriptionManager subscriptionManager_;
 };
 } // namespace Firebolt::TextToSpeech
@@ -56,8 +56,7 @@ void DeviceDemo::runOption(const std::string& method)
         auto r = Firebolt::IFireboltAccessor::Instance().DeviceInterface().deviceClass();
         if (succeed(r))
         {
-            std::cout << "Device Class: " << Firebolt::JSON::toString(Firebolt::Device::JsonData::DeviceClassEnum, *r)
-                      << std::endl;
+            std::cout << "Device Class: " << Firebolt::Device::JsonData::DeviceClassEnum.name(*r) << std::endl;
         }
     }
     else if (method == "Device.hdr")
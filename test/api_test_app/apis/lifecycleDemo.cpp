@@ -51,7 +51,7 @@ void LifecycleDemo::runOption(const std::string& method)
         if (succeed(r))
         {
             std::cout << "Current Lifecycle State: "
-                      << Firebolt::JSON::toString(Firebolt::Lifecycle::JsonData::LifecycleStateEnum, *r) << std::endl;
+                      << Firebolt::Lifecycle::JsonData::LifecycleStateEnum.name(*r) << std::endl;
         }
     }
     else if (method == "Lifecycle2.onStateChanged")
@@ -61,10 +61,8 @@ void LifecycleDemo::runOption(const std::string& method)
             std::cout << "Lifecycle State Changes received:" << std::endl;
             for (const auto& change : changes)
             {
-                std::cout << "  From "
-                          << Firebolt::JSON::toString(Firebolt::Lifecycle::JsonData::LifecycleStateEnum, change.oldState)
-                          << " to "
-                          << Firebolt::JSON::toString(Firebolt::Lifecycle::JsonData::LifecycleStateEnum, change.newState)
+                std::cout << "  From " << Firebolt::Lifecycle::JsonData::LifecycleStateEnum.name(change.oldState)
+                          << " to " << Firebolt::Lifecycle::JsonData::LifecycleStateEnum.name(change.newState)
                           << std::endl;
                 currentState_ = change.newState;
             }
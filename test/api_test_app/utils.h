@@ -63,11 +63,11 @@ protected:
     std::vector<std::string> methods_;
 };
 
-template <typename T> T chooseEnumFromList(const Firebolt::JSON::EnumType<T>& enumType, const std::string& prompt)
+template <typename EnumTable> auto chooseEnumFromList(const EnumTable& enumType, const std::string& prompt)
 {
     if (enumType.empty())
     {
-        throw std::runtime_error("EnumType cannot be empty");
+        throw std::runtime_error("EnumTable cannot be empty");
     }
     if (GetAppConfig().autoRun)
     {
@@ -78,7 +78,7 @@ template <typename T> T chooseEnumFromList(const Firebolt::JSON::EnumType<T>& en
     std::vector<std::string> options;
     for (const auto& pair : enumType)
     {
-        options.push_back(pair.first);
+        options.push_back(std::string(pair.first));
     }
 
     int choice = chooseFromList(options, prompt);
@@ -87,5 +87,5 @@ template <typename T> T chooseEnumFromList(const Firebolt::JSON::EnumType<T>& en
         choice = 0;
     }
 
-    return enumType.at(options[choice]);
+    return *enumType.find(options[choice]);
 }
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "firebolt/firebolt.h"
+#include "json_engine.h"
+#include <gtest/gtest.h>
+
+class BatchCTest : public ::testing::Test
+{
+protected:
+    JsonEngine jsonEngine;
+};
+
+TEST_F(BatchCTest, SettingsScreen)
+{
+    auto& accessor = Firebolt::IFireboltAccessor::Instance();
+    auto& extensions = Firebolt::IFireboltAccessorExtensions::Instance();
+    auto [captions, presentationLanguage, hdr] =
+        extensions.Batch([&] { return accessor.AccessibilityInterface().closedCaptionsSettings(); },
+                         [&] { return accessor.LocalizationInterface().presentationLanguage(); },
+                         [&] { return accessor.DeviceInterface().hdr(); });
+
+    ASSERT_TRUE(captions) << "closedCaptionsSettings() returned an error";
+    ASSERT_TRUE(presentationLanguage) << "presentationLanguage() returned an error";
+    ASSERT_TRUE(hdr) << "hdr() returned an error";
+
+    auto expectedCaptions = jsonEngine.get_value("Accessibility.closedCaptionsSettings");
+    EXPECT_EQ(captions->enabled, expectedCaptions.at("enabled").get<bool>());
+    EXPECT_EQ(*presentationLanguage,
+              jsonEngine.get_value("Localization.presentationLanguage").get<std::string>());
+    EXPECT_EQ(hdr->hdr10, jsonEngine.get_value("Device.hdr")["hdr10"].get<bool>());
+}
+
+TEST_F(BatchCTest, EmptyBatch)
+{
+    auto results = Firebolt::IFireboltAccessorExtensions::Instance().Batch();
+    EXPECT_EQ(std::tuple_size_v<decltype(results)>, 0u);
+}
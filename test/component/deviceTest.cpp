@@ -48,7 +48,7 @@ TEST_F(DeviceCTest, DeviceClass)
     auto expectedValue = jsonEngine.get_value("Device.deviceClass");
     auto result = Firebolt::IFireboltAccessor::Instance().DeviceInterface().deviceClass();
     ASSERT_TRUE(result) << "DeviceImpl::deviceClass() returned an error";
-    EXPECT_EQ(static_cast<int>(*result), static_cast<int>(Firebolt::Device::JsonData::DeviceClassEnum.at(expectedValue)));
+    EXPECT_EQ(Firebolt::Device::JsonData::DeviceClassEnum.find(expectedValue.get<std::string>()), *result);
 }
 
 TEST_F(DeviceCTest, Hdr)
@@ -83,6 +83,17 @@ TEST_F(DeviceCTest, Uid)
     EXPECT_EQ(*result, expectedValue);
 }
 
+TEST_F(DeviceCTest, UidAsync)
+{
+    auto expectedValue = jsonEngine.get_value("Device.uid");
+    auto& accessor = Firebolt::IFireboltAccessor::Instance();
+    auto& extensions = Firebolt::IFireboltAccessorExtensions::Instance();
+    auto future = extensions.Async([&] { return accessor.DeviceInterface().uid(); });
+    auto result = future.get();
+    ASSERT_TRUE(result) << "DeviceImpl::uid() returned an error";
+    EXPECT_EQ(*result, expectedValue);
+}
+
 TEST_F(DeviceCTest, Uptime)
 {
     auto expectedValue = jsonEngine.get_value("Device.uptime");
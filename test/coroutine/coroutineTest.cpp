@@ -0,0 +1,163 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "device_impl.h"
+#include "executor.h"
+#include "firebolt/coroutine.h"
+#include "json_engine.h"
+#include "unit/mock_helper.h"
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Starts eagerly and runs to completion on whichever thread resumes it
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Accessor whose Async() runs on a worker pool and whose Device interface talks to the mock helper
+class TestAccessor : public Firebolt::IFireboltAccessor, public Firebolt::IFireboltAccessorExtensions
+{
+public:
+    explicit TestAccessor(Firebolt::Device::IDevice& device)
+        : device_(device)
+    {
+    }
+
+    MOCK_METHOD(Firebolt::Error, Connect, (const Firebolt::Config& config, OnConnectionChanged listener), (override));
+    MOCK_METHOD(Firebolt::Error, Disconnect, (), (override));
+    MOCK_METHOD(Firebolt::Accessibility::IAccessibility&, AccessibilityInterface, (), (override));
+    MOCK_METHOD(Firebolt::Advertising::IAdvertising&, AdvertisingInterface, (), (override));
+    MOCK_METHOD(Firebolt::Discovery::IDiscovery&, DiscoveryInterface, (), (override));
+    MOCK_METHOD(Firebolt::Display::IDisplay&, DisplayInterface, (), (override));
+    MOCK_METHOD(Firebolt::Lifecycle::ILifecycle&, LifecycleInterface, (), (override));
+    MOCK_METHOD(Firebolt::Localization::ILocalization&, LocalizationInterface, (), (override));
+    MOCK_METHOD(Firebolt::Metrics::IMetrics&, MetricsInterface, (), (override));
+    MOCK_METHOD(Firebolt::Network::INetwork&, NetworkInterface, (), (override));
+    MOCK_METHOD(Firebolt::Presentation::IPresentation&, PresentationInterface, (), (override));
+    MOCK_METHOD(Firebolt::Stats::IStats&, StatsInterface, (), (override));
+    MOCK_METHOD(Firebolt::TextToSpeech::ITextToSpeech&, TextToSpeechInterface, (), (override));
+    MOCK_METHOD(Firebolt::Actions::IActions&, ActionsInterface, (), (override));
+    MOCK_METHOD(Firebolt::Error, Connect,
+                (const Firebolt::Config& config, const Firebolt::ClientOptions& options, OnConnectionChanged listener),
+                (override));
+    MOCK_METHOD(Firebolt::EventDispatchStats, EventDispatchStatistics, (), (const, override));
+    MOCK_METHOD(int, EventFd, (), (const, override));
+    MOCK_METHOD(std::size_t, DispatchPending, (std::size_t maxEvents), (override));
+    MOCK_METHOD(Firebolt::Result<void>, SetEventDelivery,
+                (Firebolt::SubscriptionId id, Firebolt::EventDelivery delivery), (override));
+    MOCK_METHOD(Firebolt::Result<void>, SetDistinctUntilChanged, (Firebolt::SubscriptionId id, bool distinct),
+                (override));
+
+    Firebolt::Device::IDevice& DeviceInterface() override { return device_; }
+
+protected:
+    void Post(std::function<void()> task) override { executor_.post(std::move(task)); }
+    void RunBatch(std::vector<std::function<void()>>& tasks) override { executor_.runAll(tasks); }
+
+private:
+    Firebolt::Device::IDevice& device_;
+    Firebolt::Internal::Executor executor_{1};
+};
+
+// Resumes coroutines on the thread that calls runOne(), like an application's event loop
+class Loop
+{
+public:
+    void post(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock{mutex_};
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    bool runOne(std::chrono::seconds timeout)
+    {
+        std::unique_lock lock{mutex_};
+        if (!cv_.wait_for(lock, timeout, [this] { return !tasks_.empty(); }))
+        {
+            return false;
+        }
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+};
+
+Task fetchUid(TestAccessor& accessor, Loop& loop, std::optional<Firebolt::Result<std::string>>& uid,
+              std::thread::id& resumedOn)
+{
+    uid = co_await Firebolt::Awaitable(
+        accessor, [&accessor] { return accessor.DeviceInterface().uid(); },
+        [&loop](std::function<void()> resume) { loop.post(std::move(resume)); });
+    resumedOn = std::this_thread::get_id();
+}
+} // namespace
+
+class CoroutineUTest : public ::testing::Test, protected MockBase
+{
+protected:
+    Firebolt::Device::DeviceImpl deviceImpl_{mockHelper};
+    TestAccessor accessor_{deviceImpl_};
+};
+
+TEST_F(CoroutineUTest, AwaitResumesThroughExecutor)
+{
+    mock("Device.uid");
+    Loop loop;
+    std::optional<Firebolt::Result<std::string>> uid;
+    std::thread::id resumedOn;
+
+    fetchUid(accessor_, loop, uid, resumedOn);
+    // Suspended until the loop runs the continuation
+    EXPECT_FALSE(uid.has_value());
+    ASSERT_TRUE(loop.runOne(std::chrono::seconds(5)));
+
+    ASSERT_TRUE(uid.has_value());
+    ASSERT_TRUE(*uid) << "Device.uid returned an error";
+    EXPECT_EQ(**uid, jsonEngine.get_value("Device.uid").get<std::string>());
+    EXPECT_EQ(resumedOn, std::this_thread::get_id());
+}
@@ -45,6 +45,27 @@ TEST_F(AccessibilityUTest, AudioDescriptionBadResponse)
         << "AccessibilityImpl::audioDescription() did not return an error";
 }
 
+TEST_F(AccessibilityUTest, ClosedCaptionsSettingsFromPropertyCache)
+{
+    Firebolt::ClientOptions options;
+    options.propertyCache = true;
+    accessibilityImpl_.configure(options);
+
+    mockEventSource("Accessibility.onClosedCaptionsSettingsChanged");
+    mock("Accessibility.closedCaptionsSettings");
+
+    auto result = accessibilityImpl_.closedCaptionsSettings();
+    ASSERT_TRUE(result) << "AccessibilityImpl::closedCaptionsSettings() returned an error";
+
+    emitEvent("Accessibility.onClosedCaptionsSettingsChanged",
+              nlohmann::json{{"enabled", !result->enabled}, {"preferredLanguages", {"fra"}}});
+
+    auto cached = accessibilityImpl_.closedCaptionsSettings();
+    ASSERT_TRUE(cached) << "AccessibilityImpl::closedCaptionsSettings() did not return the cached value";
+    EXPECT_EQ(cached->enabled, !result->enabled);
+    EXPECT_EQ(cached->preferredLanguages, std::vector<std::string>{"fra"});
+}
+
 TEST_F(AccessibilityUTest, SubscribeOnAudioDescriptionChanged)
 {
     nlohmann::json expectedValue = 1;
@@ -34,9 +34,14 @@ TEST_F(ActionsGeneratedUTest, Constructs)
 
 TEST_F(ActionsGeneratedUTest, UnsubscribeForwardsToHelper)
 {
+    EXPECT_CALL(mockHelper, subscribe(::testing::_, "Actions.onIntent", ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(Firebolt::Result<Firebolt::SubscriptionId>{7}));
+    auto id = impl.subscribeOnIntent([](const std::string&) {});
+    ASSERT_TRUE(id);
+
     EXPECT_CALL(mockHelper, unsubscribe(7)).WillOnce(::testing::Return(Firebolt::Result<void>{Firebolt::Error::None}));
 
-    auto result = impl.unsubscribe(7);
+    auto result = impl.unsubscribe(*id);
     ASSERT_TRUE(result) << "unsubscribe should return success when helper succeeds";
 }
 
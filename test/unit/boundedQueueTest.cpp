@@ -0,0 +1,77 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bounded_queue.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueueUTest, FifoUntilFull)
+{
+    Firebolt::Internal::BoundedQueue<std::string> queue{4};
+    ASSERT_EQ(queue.capacity(), 4u);
+    EXPECT_TRUE(queue.empty());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.push(std::to_string(i)));
+    }
+    EXPECT_FALSE(queue.push("overflow"));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto value = queue.pop();
+        ASSERT_TRUE(value);
+        EXPECT_EQ(*value, std::to_string(i));
+    }
+    EXPECT_FALSE(queue.pop());
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedQueueUTest, ConcurrentProducers)
+{
+    Firebolt::Internal::BoundedQueue<int> queue{1024};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p)
+    {
+        producers.emplace_back(
+            [&queue, p]
+            {
+                for (int i = 0; i < 200; ++i)
+                {
+                    queue.push(p * 1000 + i);
+                }
+            });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    std::vector<int> lastSeen(4, -1);
+    int count = 0;
+    while (auto value = queue.pop())
+    {
+        int producer = *value / 1000;
+        EXPECT_GT(*value % 1000, lastSeen[producer]);
+        lastSeen[producer] = *value % 1000;
+        ++count;
+    }
+    EXPECT_EQ(count, 800);
+}
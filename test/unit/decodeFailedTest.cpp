@@ -0,0 +1,71 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "json_decode.h"
+#include "json_types/json_struct.h"
+#include "json_types/stats.h"
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+// Also built with -fno-exceptions when ENABLE_EXCEPTIONS is OFF, so nothing here may throw or catch
+
+namespace
+{
+class EvenJson : public Firebolt::JSON::NL_Json_Basic<int>
+{
+public:
+    void fromJson(const nlohmann::json& json) override
+    {
+        if (!json.is_number_integer() || json.get<int>() % 2 != 0)
+        {
+            Firebolt::Internal::decodeFailed("Not an even number");
+            return;
+        }
+        value_ = json.get<int>();
+    }
+    int value() const override { return value_; }
+
+private:
+    int value_ = 0;
+};
+} // namespace
+
+TEST(DecodeFailedUTest, FromJsonReportsFailure)
+{
+    EvenJson even;
+    EXPECT_FALSE(Firebolt::Internal::fromJson(even, 3));
+    EXPECT_TRUE(Firebolt::Internal::fromJson(even, 4));
+    EXPECT_EQ(even.value(), 4);
+}
+
+TEST(DecodeFailedUTest, DecoderMapsFailureToInvalidParams)
+{
+    auto odd = Firebolt::Internal::Decoder<EvenJson>::decode(3);
+    ASSERT_FALSE(odd);
+    EXPECT_EQ(odd.error(), Firebolt::Error::InvalidParams);
+
+    auto even = Firebolt::Internal::Decoder<EvenJson>::decode(4);
+    ASSERT_TRUE(even);
+    EXPECT_EQ(*even, 4);
+}
+
+TEST(DecodeFailedUTest, StructWithMissingFieldFails)
+{
+    Firebolt::Stats::JsonData::MemoryInfo memory;
+    EXPECT_FALSE(Firebolt::Internal::fromJson(memory, nlohmann::json{{"gpuMemoryUsedKiB", 1}}));
+}
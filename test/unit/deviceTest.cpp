@@ -53,7 +53,7 @@ TEST_F(DeviceUTest, DeviceClass)
 
     ASSERT_TRUE(result) << "DeviceImpl::deviceClass() returned an error";
 
-    EXPECT_EQ(static_cast<int>(*result), static_cast<int>(Firebolt::Device::JsonData::DeviceClassEnum.at(expectedValue)));
+    EXPECT_EQ(Firebolt::Device::JsonData::DeviceClassEnum.find(expectedValue.get<std::string>()), *result);
 }
 
 TEST_F(DeviceUTest, DeviceClassBadResponse)
@@ -110,6 +110,26 @@ TEST_F(DeviceUTest, UidBadResponse)
     mock_with_response("Device.uid", 67890);
     ASSERT_FALSE(deviceImpl_.uid()) << "DeviceImpl::uid() did not return an error";
 }
+
+TEST_F(DeviceUTest, UidFetchedOncePerConnection)
+{
+    mock("Device.uid");
+    auto expectedValue = jsonEngine.get_value("Device.uid");
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto result = deviceImpl_.uid();
+        ASSERT_TRUE(result) << "DeviceImpl::uid() returned an error";
+        EXPECT_EQ(*result, expectedValue);
+    }
+
+    deviceImpl_.onConnectionChanged(true);
+    mock_with_response("Device.uid", "new-uid");
+
+    auto result = deviceImpl_.uid();
+    ASSERT_TRUE(result) << "DeviceImpl::uid() returned an error";
+    EXPECT_EQ(*result, "new-uid");
+}
 TEST_F(DeviceUTest, Uptime)
 {
     mock("Device.uptime");
@@ -121,6 +141,45 @@ TEST_F(DeviceUTest, Uptime)
     EXPECT_EQ(*result, expectedValue);
 }
 
+TEST_F(DeviceUTest, UptimeExtrapolatedLocally)
+{
+    Firebolt::ClientOptions options;
+    options.clockResyncInterval = std::chrono::minutes(1);
+    deviceImpl_.configure(options);
+
+    mock_with_response("Device.uptime", 1000);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto result = deviceImpl_.uptime();
+        ASSERT_TRUE(result) << "DeviceImpl::uptime() returned an error";
+        EXPECT_EQ(*result, 1000u);
+    }
+}
+
+TEST_F(DeviceUTest, TimeInActiveStateResampledOnReconnect)
+{
+    Firebolt::ClientOptions options;
+    options.clockResyncInterval = std::chrono::minutes(1);
+    deviceImpl_.configure(options);
+
+    mock_with_response("Device.timeInActiveState", 500);
+
+    auto result = deviceImpl_.timeInActiveState();
+    ASSERT_TRUE(result) << "DeviceImpl::timeInActiveState() returned an error";
+    EXPECT_EQ(*result, 500u);
+    result = deviceImpl_.timeInActiveState();
+    ASSERT_TRUE(result) << "DeviceImpl::timeInActiveState() returned an error";
+    EXPECT_EQ(*result, 500u);
+
+    deviceImpl_.onConnectionChanged(true);
+    mock_with_response("Device.timeInActiveState", 510);
+
+    result = deviceImpl_.timeInActiveState();
+    ASSERT_TRUE(result) << "DeviceImpl::timeInActiveState() returned an error";
+    EXPECT_EQ(*result, 510u);
+}
+
 TEST_F(DeviceUTest, UptimeBadResponse)
 {
     mock_with_response("Device.uptime", "invalid_response");
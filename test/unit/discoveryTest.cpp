@@ -20,7 +20,9 @@
 #include "json_engine.h"
 #include "json_types/common.h"
 #include "mock_helper.h"
+#include <cstdio>
 #include <firebolt/json_types.h>
+#include <future>
 
 class DiscoveryUTest : public ::testing::Test, protected MockBase
 {
@@ -114,3 +116,32 @@ TEST_F(DiscoveryUTest, watchedV2_payload)
     ASSERT_TRUE(result) << "Error on watchedV2";
     EXPECT_TRUE(*result);
 }
+
+TEST_F(DiscoveryUTest, watchedStoredWhileDisconnected)
+{
+    Firebolt::ClientOptions options;
+    options.outboxDirectory = ::testing::TempDir();
+    std::remove((options.outboxDirectory + "/discovery.outbox").c_str());
+    discoveryImpl_.configure(options);
+    discoveryImpl_.onConnectionChanged(false);
+
+    EXPECT_CALL(mockHelper, getJson("Discovery.watched", _)).Times(0);
+    auto result = discoveryImpl_.watched("content123", 0.5, false, std::nullopt, std::nullopt);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(*result);
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    std::promise<nlohmann::json> replayed;
+    auto future = replayed.get_future();
+    EXPECT_CALL(mockHelper, getJson("Discovery.watched", _))
+        .WillOnce(Invoke(
+            [&replayed](const std::string& /*methodName*/, const nlohmann::json& parameters)
+            {
+                replayed.set_value(parameters);
+                return Firebolt::Result<nlohmann::json>{true};
+            }));
+    discoveryImpl_.onConnectionChanged(true);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get()["entityId"], "content123");
+}
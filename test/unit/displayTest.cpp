@@ -54,6 +54,22 @@ TEST_F(DisplayUTest, MaxResolutionBadResponse)
     ASSERT_FALSE(displayImpl_.maxResolution()) << "DisplayImpl::maxResolution() did not return an error";
 }
 
+TEST_F(DisplayUTest, MaxResolutionErrorNotMemoized)
+{
+    mock_with_response("Display.maxResolution", "bad_response");
+    ASSERT_FALSE(displayImpl_.maxResolution()) << "DisplayImpl::maxResolution() did not return an error";
+
+    mock("Display.maxResolution");
+    auto expectedValue = jsonEngine.get_value("Display.maxResolution");
+
+    for (int i = 0; i < 2; ++i)
+    {
+        auto result = displayImpl_.maxResolution();
+        ASSERT_TRUE(result) << "DisplayImpl::maxResolution() returned an error";
+        EXPECT_EQ(result->width, expectedValue.at("width").get<uint32_t>());
+    }
+}
+
 TEST_F(DisplayUTest, Size)
 {
     mock("Display.size");
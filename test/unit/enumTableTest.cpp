@@ -0,0 +1,50 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "json_types/enum_table.h"
+#include "json_types/lifecycle.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using Firebolt::Lifecycle::LifecycleState;
+using Firebolt::Lifecycle::JsonData::LifecycleStateEnum;
+
+static_assert(LifecycleStateEnum.find("paused") == LifecycleState::PAUSED);
+static_assert(LifecycleStateEnum.name(LifecycleState::TERMINATING) == "terminating");
+
+TEST(EnumTableUTest, FindsEveryName)
+{
+    for (const auto& entry : LifecycleStateEnum)
+    {
+        EXPECT_EQ(LifecycleStateEnum.find(entry.first), entry.second) << entry.first;
+        EXPECT_EQ(LifecycleStateEnum.name(entry.second), entry.first);
+    }
+}
+
+TEST(EnumTableUTest, UnknownNameNotFound)
+{
+    EXPECT_FALSE(LifecycleStateEnum.find(""));
+    EXPECT_FALSE(LifecycleStateEnum.find("Active"));
+    EXPECT_FALSE(LifecycleStateEnum.find("activ"));
+    EXPECT_FALSE(LifecycleStateEnum.find(std::string("active\0", 7)));
+}
+
+TEST(EnumTableUTest, ValueOutsideEnumHasNoName)
+{
+    EXPECT_TRUE(LifecycleStateEnum.name(static_cast<LifecycleState>(42)).empty());
+}
@@ -0,0 +1,374 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "json_decode.h"
+#include "mock_helper.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <vector>
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using Firebolt::Internal::Method;
+using Firebolt::Internal::SubscriptionManager;
+
+namespace
+{
+// Counts how often an event payload is decoded
+class CountedBoolean : public Firebolt::JSON::NL_Json_Basic<bool>
+{
+public:
+    void fromJson(const nlohmann::json& json) override
+    {
+        ++decoded;
+        value_ = json.get<bool>();
+    }
+    bool value() const override { return value_; }
+
+    static inline int decoded = 0;
+
+private:
+    bool value_ = false;
+};
+} // namespace
+
+class EventChannelsUTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        CountedBoolean::decoded = 0;
+        ON_CALL(mockHelper, subscribe(_, _, _, _))
+            .WillByDefault(Invoke(
+                [this](void* /*owner*/, const std::string& /*eventName*/, std::any&& notification,
+                       void (*callback)(void*, const nlohmann::json&))
+                {
+                    notification_ = std::move(notification);
+                    callback_ = callback;
+                    return Firebolt::Result<Firebolt::SubscriptionId>{1};
+                }));
+    }
+
+    void emit(const nlohmann::json& payload) { callback_(&notification_, payload); }
+
+    ::testing::NiceMock<MockHelper> mockHelper;
+    std::any notification_;
+    void (*callback_)(void*, const nlohmann::json&) = nullptr;
+};
+
+TEST_F(EventChannelsUTest, ListenersShareOnePlatformSubscription)
+{
+    EXPECT_CALL(mockHelper, subscribe(_, "Presentation.onFocusedChanged", _, _)).Times(1);
+    SubscriptionManager first{mockHelper, this};
+    SubscriptionManager second{mockHelper, &first};
+
+    std::vector<bool> received;
+    auto listener = [&received](bool value) { received.push_back(value); };
+    auto a = first.subscribe<CountedBoolean, bool>(Method::PresentationOnFocusedChanged, listener);
+    auto b = second.subscribe<CountedBoolean, bool>(Method::PresentationOnFocusedChanged, listener);
+    auto c = second.subscribe<CountedBoolean, bool>(Method::PresentationOnFocusedChanged, listener);
+    ASSERT_TRUE(a && b && c);
+    EXPECT_NE(*b, *a);
+    EXPECT_NE(*c, *b);
+
+    emit(true);
+    EXPECT_EQ(received, (std::vector<bool>{true, true, true}));
+    EXPECT_EQ(CountedBoolean::decoded, 1);
+}
+
+TEST_F(EventChannelsUTest, LastUnsubscribeDropsPlatformSubscription)
+{
+    SubscriptionManager manager{mockHelper, this};
+    auto a = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [](bool) {});
+    auto b = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [](bool) {});
+    ASSERT_TRUE(a && b);
+
+    EXPECT_CALL(mockHelper, unsubscribe(_)).Times(0);
+    EXPECT_TRUE(manager.unsubscribe(*a));
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    EXPECT_CALL(mockHelper, unsubscribe(1)).WillOnce(Return(Firebolt::Result<void>{Firebolt::Error::None}));
+    EXPECT_TRUE(manager.unsubscribe(*b));
+}
+
+TEST_F(EventChannelsUTest, UnsubscribeAllKeepsOtherOwners)
+{
+    SubscriptionManager first{mockHelper, this};
+    SubscriptionManager second{mockHelper, &first};
+    int calls = 0;
+    first.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [&calls](bool) { ++calls; });
+    second.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [&calls](bool) { ++calls; });
+
+    EXPECT_CALL(mockHelper, unsubscribe(_)).Times(0);
+    first.unsubscribeAll();
+    emit(false);
+    EXPECT_EQ(calls, 1);
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    EXPECT_CALL(mockHelper, unsubscribe(1)).WillOnce(Return(Firebolt::Result<void>{Firebolt::Error::None}));
+    second.unsubscribeAll();
+}
+
+TEST_F(EventChannelsUTest, ListenersDecodingDifferentlyGetTheirOwnValue)
+{
+    SubscriptionManager manager{mockHelper, this};
+    bool flag = false;
+    std::string text;
+    manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                     [&flag](bool value) { flag = value; });
+    manager.subscribe<CountedBoolean, bool>(Method::PresentationOnFocusedChanged,
+                                            [&text](bool value) { text = value ? "yes" : "no"; });
+
+    emit(true);
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(text, "yes");
+}
+
+TEST_F(EventChannelsUTest, UnknownIdNotPassedToHelper)
+{
+    SubscriptionManager manager{mockHelper, this};
+    EXPECT_CALL(mockHelper, unsubscribe(_)).Times(0);
+    EXPECT_FALSE(manager.unsubscribe(42));
+}
+
+TEST_F(EventChannelsUTest, ListenerIdsAreNotPlatformIds)
+{
+    EXPECT_CALL(mockHelper, subscribe(_, _, _, _))
+        .WillOnce(Return(Firebolt::Result<Firebolt::SubscriptionId>{100}));
+    SubscriptionManager manager{mockHelper, this};
+    auto a = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [](bool) {});
+    ASSERT_TRUE(a);
+    EXPECT_NE(*a, 100u);
+
+    EXPECT_CALL(mockHelper, unsubscribe(_)).Times(0);
+    EXPECT_FALSE(manager.unsubscribe(100));
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    EXPECT_CALL(mockHelper, unsubscribe(100)).WillOnce(Return(Firebolt::Result<void>{Firebolt::Error::None}));
+    EXPECT_TRUE(manager.unsubscribe(*a));
+}
+
+TEST_F(EventChannelsUTest, DoubleUnsubscribeFails)
+{
+    SubscriptionManager manager{mockHelper, this};
+    int calls = 0;
+    auto a = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged, [](bool) {});
+    auto b = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                              [&calls](bool) { ++calls; });
+    ASSERT_TRUE(a && b);
+
+    EXPECT_CALL(mockHelper, unsubscribe(_)).Times(0);
+    EXPECT_TRUE(manager.unsubscribe(*a));
+    EXPECT_FALSE(manager.unsubscribe(*a));
+    // The other listener keeps the platform subscription
+    emit(true);
+    EXPECT_EQ(calls, 1);
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    EXPECT_CALL(mockHelper, unsubscribe(1)).WillOnce(Return(Firebolt::Result<void>{Firebolt::Error::None}));
+    EXPECT_TRUE(manager.unsubscribe(*b));
+    EXPECT_FALSE(manager.unsubscribe(*b));
+}
+
+TEST_F(EventChannelsUTest, QueuedDispatchDoesNotBlockTransport)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::THREAD;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<bool> received;
+    manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                     [&](bool value)
+                                                     {
+                                                         released.wait();
+                                                         received.set_value(value);
+                                                     });
+
+    // Returns while the callback is still blocked
+    emit(true);
+    release.set_value();
+    auto future = received.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(future.get());
+}
+
+TEST_F(EventChannelsUTest, ConflatingListenerGetsNewestQueuedEvent)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::MAIN_LOOP;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    std::vector<bool> all;
+    std::vector<bool> latest;
+    auto a = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                              [&all](bool value) { all.push_back(value); });
+    auto b = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                              [&latest](bool value) { latest.push_back(value); });
+    ASSERT_TRUE(a && b);
+    EXPECT_TRUE(channels->setDelivery(*b, Firebolt::EventDelivery::CONFLATE));
+    EXPECT_FALSE(channels->setDelivery(42, Firebolt::EventDelivery::CONFLATE));
+
+    emit(true);
+    emit(false);
+    emit(true);
+    emit(false);
+    channels->dispatchPending(100);
+    EXPECT_EQ(all, (std::vector<bool>{true, false, true, false}));
+    EXPECT_EQ(latest, (std::vector<bool>{false}));
+    EXPECT_EQ(channels->stats().conflated, 3u);
+
+    // Queued again once the newest event was delivered
+    emit(true);
+    channels->dispatchPending(100);
+    EXPECT_EQ(latest, (std::vector<bool>{false, true}));
+
+    EXPECT_TRUE(channels->setDelivery(*b, Firebolt::EventDelivery::ALL));
+    emit(false);
+    emit(true);
+    channels->dispatchPending(100);
+    EXPECT_EQ(latest, (std::vector<bool>{false, true, false, true}));
+}
+
+TEST_F(EventChannelsUTest, DistinctListenerSkipsRepeatedEventsBeforeDecoding)
+{
+    SubscriptionManager manager{mockHelper, this};
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    std::vector<bool> received;
+    auto id = manager.subscribe<CountedBoolean, bool>(Method::PresentationOnFocusedChanged,
+                                                      [&received](bool value) { received.push_back(value); });
+    ASSERT_TRUE(id);
+    EXPECT_TRUE(channels->setDistinct(*id, true));
+    EXPECT_FALSE(channels->setDistinct(42, true));
+
+    emit(true);
+    emit(true);
+    emit(false);
+    emit(false);
+    emit(true);
+    EXPECT_EQ(received, (std::vector<bool>{true, false, true}));
+    EXPECT_EQ(CountedBoolean::decoded, 3);
+    EXPECT_EQ(channels->stats().duplicates, 2u);
+
+    EXPECT_TRUE(channels->setDistinct(*id, false));
+    emit(true);
+    EXPECT_EQ(received, (std::vector<bool>{true, false, true, true}));
+}
+
+TEST_F(EventChannelsUTest, RepeatedEventsAreNotQueued)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::MAIN_LOOP;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    std::vector<bool> received;
+    auto id = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                               [&received](bool value) { received.push_back(value); });
+    ASSERT_TRUE(id);
+    EXPECT_TRUE(channels->setDistinct(*id, true));
+
+    emit(true);
+    emit(true);
+    emit(true);
+    emit(false);
+    EXPECT_EQ(channels->stats().queueDepth, 2u);
+    EXPECT_EQ(channels->stats().duplicates, 2u);
+    channels->dispatchPending(100);
+    EXPECT_EQ(received, (std::vector<bool>{true, false}));
+}
+
+TEST_F(EventChannelsUTest, QueuedEventNotDeliveredAfterUnsubscribe)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::MAIN_LOOP;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    int calls = 0;
+    auto id = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                               [&calls](bool) { ++calls; });
+    ASSERT_TRUE(id);
+
+    emit(true);
+    EXPECT_TRUE(manager.unsubscribe(*id));
+    channels->dispatchPending(100);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(EventChannelsUTest, UnsubscribeWaitsForCallbackInProgress)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::THREAD;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> returned{false};
+    auto id = manager.subscribe<Firebolt::JSON::Boolean, bool>(Method::PresentationOnFocusedChanged,
+                                                               [&](bool)
+                                                               {
+                                                                   started.set_value();
+                                                                   released.wait();
+                                                                   returned.store(true);
+                                                               });
+    ASSERT_TRUE(id);
+
+    emit(true);
+    ASSERT_EQ(started.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    auto unsubscribed = std::async(std::launch::async, [&] { return manager.unsubscribe(*id); });
+    EXPECT_EQ(unsubscribed.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    release.set_value();
+    EXPECT_TRUE(unsubscribed.get());
+    EXPECT_TRUE(returned.load());
+}
+
+TEST_F(EventChannelsUTest, ListenerMayUnsubscribeItself)
+{
+    Firebolt::ClientOptions options;
+    options.eventDispatch = Firebolt::EventDispatch::THREAD;
+    auto channels = Firebolt::Internal::EventChannels::of(mockHelper);
+    channels->configure(options);
+
+    SubscriptionManager manager{mockHelper, this};
+    std::promise<bool> unsubscribed;
+    Firebolt::SubscriptionId id = 0;
+    auto result = manager.subscribe<Firebolt::JSON::Boolean, bool>(
+        Method::PresentationOnFocusedChanged,
+        [&](bool) { unsubscribed.set_value(static_cast<bool>(manager.unsubscribe(id))); });
+    ASSERT_TRUE(result);
+    id = *result;
+
+    emit(true);
+    auto future = unsubscribed.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(future.get());
+}
@@ -0,0 +1,418 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "event_executor.h"
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <poll.h>
+#include <thread>
+#include <vector>
+
+using Firebolt::EventDispatch;
+using Firebolt::Internal::EventExecutor;
+
+namespace
+{
+// Blocks deliveries until opened
+class Gate
+{
+public:
+    void wait()
+    {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] { return open_; });
+    }
+    void open()
+    {
+        {
+            std::lock_guard lock{mutex_};
+            open_ = true;
+        }
+        cv_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_ = false;
+};
+
+bool readable(int fd)
+{
+    pollfd entry{fd, POLLIN, 0};
+    return ::poll(&entry, 1, 0) == 1 && (entry.revents & POLLIN) != 0;
+}
+} // namespace
+
+TEST(EventExecutorUTest, InlineRunsOnCaller)
+{
+    EventExecutor executor;
+    ASSERT_TRUE(executor.isInline());
+    std::thread::id ranOn;
+    executor.runInline([&ranOn] { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+    EXPECT_EQ(executor.stats().delivered, 1u);
+}
+
+TEST(EventExecutorUTest, ThreadKeepsArrivalOrder)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::THREAD, 0);
+    ASSERT_FALSE(executor.isInline());
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+    for (int i = 0; i < 20; ++i)
+    {
+        const void* key = &order + i % 3;
+        executor.post(key,
+                      [&, i]
+                      {
+                          std::lock_guard lock{mutex};
+                          order.push_back(i);
+                          if (i == 19)
+                          {
+                              done.set_value();
+                          }
+                      });
+    }
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::lock_guard lock{mutex};
+    ASSERT_EQ(order.size(), 20u);
+    for (int i = 0; i < 20; ++i)
+    {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(EventExecutorUTest, ThreadKeepsArrivalOrderAcrossKeys)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::THREAD, 0);
+
+    int a = 0;
+    int b = 0;
+    Gate gate;
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+    // The first delivery is still running while the others queue up behind it
+    const void* keys[] = {&a, &a, &b, &a};
+    for (int i = 0; i < 4; ++i)
+    {
+        executor.post(keys[i],
+                      [&, i]
+                      {
+                          if (i == 0)
+                          {
+                              gate.wait();
+                          }
+                          std::lock_guard lock{mutex};
+                          order.push_back(i);
+                          if (i == 3)
+                          {
+                              done.set_value();
+                          }
+                      });
+    }
+    gate.open();
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::lock_guard lock{mutex};
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(EventExecutorUTest, PoolKeepsOrderPerKeyAndRunsKeysConcurrently)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::POOL, 2);
+
+    Gate gate;
+    int slow = 0;
+    int fast = 0;
+    std::promise<void> fastDone;
+    std::promise<void> slowDone;
+    executor.post(&slow,
+                  [&]
+                  {
+                      gate.wait();
+                      slow = 1;
+                  });
+    executor.post(&slow,
+                  [&]
+                  {
+                      EXPECT_EQ(slow, 1);
+                      slowDone.set_value();
+                  });
+    executor.post(&fast,
+                  [&]
+                  {
+                      fast = 1;
+                      fastDone.set_value();
+                  });
+
+    // The blocked key does not hold up the other one
+    ASSERT_EQ(fastDone.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(fast, 1);
+    EXPECT_GE(executor.stats().queueDepth, 1u);
+
+    gate.open();
+    ASSERT_EQ(slowDone.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+TEST(EventExecutorUTest, StatsReportQueueAndCallbackTime)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::THREAD, 0);
+
+    Gate gate;
+    std::promise<void> done;
+    executor.post(this,
+                  [&gate]
+                  {
+                      gate.wait();
+                      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                  });
+    for (int i = 0; i < 3; ++i)
+    {
+        executor.post(this, [] {});
+    }
+    executor.post(this, [&done] { done.set_value(); });
+    EXPECT_GE(executor.stats().maxQueueDepth, 4u);
+
+    gate.open();
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    // The last delivery counts once its callback returned
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (executor.stats().delivered < 5 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto stats = executor.stats();
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_EQ(stats.delivered, 5u);
+    EXPECT_GE(stats.maxCallbackTime, std::chrono::milliseconds(5));
+    EXPECT_GE(stats.totalCallbackTime, stats.maxCallbackTime);
+    EXPECT_GE(stats.maxQueueDelay, std::chrono::milliseconds(5));
+}
+
+TEST(EventExecutorUTest, MainLoopWaitsForDispatchPending)
+{
+    EventExecutor executor;
+    EXPECT_EQ(executor.eventFd(), -1);
+    executor.configure(EventDispatch::MAIN_LOOP, 0);
+    ASSERT_GE(executor.eventFd(), 0);
+    EXPECT_FALSE(executor.isInline());
+    EXPECT_FALSE(readable(executor.eventFd()));
+
+    std::vector<int> order;
+    std::vector<std::thread::id> ranOn;
+    // Posted from another thread, as the transport does
+    std::thread transport(
+        [&]
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                executor.post(this,
+                              [&, i]
+                              {
+                                  order.push_back(i);
+                                  ranOn.push_back(std::this_thread::get_id());
+                              });
+            }
+        });
+    transport.join();
+    EXPECT_TRUE(readable(executor.eventFd()));
+    EXPECT_EQ(executor.stats().queueDepth, 3u);
+    EXPECT_TRUE(order.empty());
+
+    EXPECT_EQ(executor.dispatchPending(2), 2u);
+    EXPECT_EQ(order, (std::vector<int>{0, 1}));
+    EXPECT_TRUE(readable(executor.eventFd()));
+
+    EXPECT_EQ(executor.dispatchPending(10), 1u);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    EXPECT_FALSE(readable(executor.eventFd()));
+    EXPECT_EQ(executor.dispatchPending(10), 0u);
+    for (const auto& id : ranOn)
+    {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+
+    executor.post(this, [] {});
+    EXPECT_TRUE(readable(executor.eventFd()));
+    auto stats = executor.stats();
+    EXPECT_EQ(stats.queueDepth, 1u);
+    EXPECT_EQ(stats.maxQueueDepth, 3u);
+    EXPECT_EQ(stats.delivered, 3u);
+}
+
+TEST(EventExecutorUTest, DeliveryMayReleaseTheLastReference)
+{
+    // Signals when the delivery still queued is dropped, i.e. once the executor is destroyed
+    struct Probe
+    {
+        ~Probe() { dropped->set_value(); }
+        std::shared_ptr<std::promise<void>> dropped;
+    };
+    auto dropped = std::make_shared<std::promise<void>>();
+    auto future = dropped->get_future();
+
+    std::shared_ptr<EventExecutor> executor = EventExecutor::create();
+    executor->configure(EventDispatch::THREAD, 1);
+    Gate gate;
+    executor->post(&gate,
+                   [&executor, &gate]
+                   {
+                       gate.wait();
+                       executor.reset();
+                   });
+    auto probe = std::make_shared<Probe>();
+    probe->dropped = dropped;
+    executor->post(&gate, [probe = std::move(probe)] {});
+    gate.open();
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(executor, nullptr);
+}
+
+TEST(EventExecutorUTest, LeavingMainLoopRunsPendingDeliveries)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::MAIN_LOOP, 0);
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<int> order;
+    for (int i = 0; i < 3; ++i)
+    {
+        executor.post(&executor,
+                      [&, i]
+                      {
+                          std::lock_guard lock{mutex};
+                          order.push_back(i);
+                          cv.notify_all();
+                      });
+    }
+    ASSERT_TRUE(readable(executor.eventFd()));
+
+    executor.configure(EventDispatch::THREAD, 1);
+    EXPECT_FALSE(readable(executor.eventFd()));
+    std::unique_lock lock{mutex};
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&] { return order.size() == 3; }));
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    lock.unlock();
+    EXPECT_EQ(executor.dispatchPending(10), 0u);
+}
+
+TEST(EventExecutorUTest, LeavingPoolStopsTheExtraThreads)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::POOL, 3);
+
+    Gate gate;
+    std::mutex mutex;
+    std::condition_variable cv;
+    int started = 0;
+    int finished = 0;
+    int keys[3];
+    for (auto& key : keys)
+    {
+        executor.post(&key,
+                      [&]
+                      {
+                          {
+                              std::lock_guard lock{mutex};
+                              ++started;
+                              cv.notify_all();
+                          }
+                          gate.wait();
+                          std::lock_guard lock{mutex};
+                          ++finished;
+                          cv.notify_all();
+                      });
+    }
+    std::unique_lock lock{mutex};
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&] { return started == 3; }));
+    lock.unlock();
+
+    executor.configure(EventDispatch::THREAD, 0);
+    gate.open();
+    lock.lock();
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&] { return finished == 3; }));
+    lock.unlock();
+
+    // Only one of the pool's threads is left to run them
+    std::vector<std::thread::id> ranOn;
+    std::promise<void> done;
+    for (int i = 0; i < 10; ++i)
+    {
+        executor.post(&keys[i % 3],
+                      [&, i]
+                      {
+                          ranOn.push_back(std::this_thread::get_id());
+                          if (i == 9)
+                          {
+                              done.set_value();
+                          }
+                      });
+    }
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(ranOn.size(), 10u);
+    for (const auto& id : ranOn)
+    {
+        EXPECT_EQ(id, ranOn.front());
+    }
+}
+
+TEST(EventExecutorUTest, KeyOrderKeptAcrossModeChanges)
+{
+    EventExecutor executor;
+    executor.configure(EventDispatch::THREAD, 0);
+
+    int key = 0;
+    Gate gate;
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+    executor.post(&key,
+                  [&]
+                  {
+                      gate.wait();
+                      std::lock_guard lock{mutex};
+                      order.push_back(0);
+                  });
+    // Queued while the first delivery of its key still runs, another thread of the pool must not overtake it
+    executor.configure(EventDispatch::POOL, 2);
+    executor.post(&key,
+                  [&]
+                  {
+                      std::lock_guard lock{mutex};
+                      order.push_back(1);
+                      done.set_value();
+                  });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    gate.open();
+
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::lock_guard lock{mutex};
+    EXPECT_EQ(order, (std::vector<int>{0, 1}));
+}
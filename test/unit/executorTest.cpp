@@ -0,0 +1,130 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "executor.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+TEST(ExecutorUTest, PostRunsTask)
+{
+    Firebolt::Internal::Executor executor{2};
+    std::promise<std::thread::id> ran;
+    auto future = ran.get_future();
+
+    executor.post([&ran] { ran.set_value(std::this_thread::get_id()); });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+TEST(ExecutorUTest, RunAllRunsEveryTask)
+{
+    Firebolt::Internal::Executor executor{2};
+    std::atomic<int> count{0};
+    std::vector<std::function<void()>> tasks(8, [&count] { ++count; });
+
+    executor.runAll(tasks);
+
+    EXPECT_EQ(count.load(), 8);
+}
+
+TEST(ExecutorUTest, RunAllLargerThanPoolRunsEveryTask)
+{
+    Firebolt::Internal::Executor executor{2};
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    std::atomic<int> count{0};
+    std::vector<std::function<void()>> tasks(
+        8,
+        [&]
+        {
+            int now = ++running;
+            int highest = maxRunning.load();
+            while (now > highest && !maxRunning.compare_exchange_weak(highest, now))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            --running;
+            ++count;
+        });
+
+    executor.runAll(tasks);
+
+    EXPECT_EQ(count.load(), 8);
+    // The two workers and the calling thread
+    EXPECT_LE(maxRunning.load(), 3);
+}
+
+TEST(ExecutorUTest, RunAllWaitsForEveryTaskBeforeRethrowing)
+{
+    Firebolt::Internal::Executor executor{2};
+    std::atomic<int> count{0};
+    std::vector<std::function<void()>> tasks(6,
+                                              [&count]
+                                              {
+                                                  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                                                  ++count;
+                                              });
+    // Run by the caller, which must not leave while the workers still run the others
+    tasks[0] = [] { throw std::runtime_error("failed"); };
+
+    EXPECT_THROW(executor.runAll(tasks), std::runtime_error);
+    EXPECT_EQ(count.load(), 5);
+}
+
+TEST(ExecutorUTest, RunAllFromWorkerDoesNotDeadlock)
+{
+    Firebolt::Internal::Executor executor{1};
+    std::promise<int> done;
+    auto future = done.get_future();
+
+    executor.post(
+        [&executor, &done]
+        {
+            std::atomic<int> count{0};
+            std::vector<std::function<void()>> tasks(3, [&count] { ++count; });
+            executor.runAll(tasks);
+            done.set_value(count.load());
+        });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get(), 3);
+}
+
+TEST(ExecutorUTest, TaskMayDestroyItsExecutor)
+{
+    auto executor = std::make_unique<Firebolt::Internal::Executor>(1);
+    // Owned by the task as well, set_value() may still be using it once the test sees the future ready
+    auto destroyed = std::make_shared<std::promise<void>>();
+    auto future = destroyed->get_future();
+
+    executor->post(
+        [&executor, destroyed]
+        {
+            executor.reset();
+            destroyed->set_value();
+        });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(executor, nullptr);
+}
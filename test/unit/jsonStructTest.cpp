@@ -0,0 +1,151 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "json_decode.h"
+#include "json_types/lifecycle.h"
+#include "json_types/stats.h"
+#include "json_types/texttospeech.h"
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Firebolt;
+
+namespace
+{
+struct Counted
+{
+    Counted() = default;
+    Counted(const Counted& other)
+        : items(other.items)
+    {
+        ++copies;
+    }
+    Counted(Counted&&) = default;
+    Counted& operator=(const Counted& other)
+    {
+        items = other.items;
+        ++copies;
+        return *this;
+    }
+    Counted& operator=(Counted&&) = default;
+
+    std::vector<std::string> items;
+    static inline int copies = 0;
+};
+
+class CountedJson : public JSON::NL_Json_Basic<Counted>
+{
+public:
+    void fromJson(const nlohmann::json& json) override { value_.items = json.get<std::vector<std::string>>(); }
+    Counted value() const override { return value_; }
+    Counted take() && { return std::move(value_); }
+
+private:
+    Counted value_;
+};
+} // namespace
+
+TEST(JsonStructUTest, RoundTrip)
+{
+    Stats::MemoryInfo info{1024, 2048, 512, 4096};
+    nlohmann::json json = Stats::JsonData::MemoryInfo::toJson(info);
+    EXPECT_EQ(json["userMemoryLimitKiB"], 2048);
+
+    Stats::JsonData::MemoryInfo decoded;
+    decoded.fromJson(json);
+    EXPECT_EQ(decoded.value().userMemoryUsed, 1024u);
+    EXPECT_EQ(decoded.value().userMemoryLimit, 2048u);
+    EXPECT_EQ(decoded.value().gpuMemoryUsed, 512u);
+    EXPECT_EQ(decoded.value().gpuMemoryLimit, 4096u);
+}
+
+TEST(JsonStructUTest, EnumFieldsUseTheirStrings)
+{
+    Lifecycle::StateChange change{Lifecycle::LifecycleState::INITIALIZING, Lifecycle::LifecycleState::ACTIVE};
+    nlohmann::json json = Lifecycle::JsonData::StateChange::toJson(change);
+    EXPECT_EQ(json["newState"], "active");
+
+    Lifecycle::JsonData::StateChange decoded;
+    decoded.fromJson(json);
+    EXPECT_EQ(decoded.value().oldState, Lifecycle::LifecycleState::INITIALIZING);
+    EXPECT_EQ(decoded.value().newState, Lifecycle::LifecycleState::ACTIVE);
+}
+
+TEST(JsonStructUTest, UnknownKeysIgnored)
+{
+    TextToSpeech::JsonData::TTSStatusResponse decoded;
+    decoded.fromJson({{"TTS_Status", 3}, {"success", true}, {"extra", "ignored"}});
+    EXPECT_EQ(decoded.value().ttsStatus, 3u);
+    EXPECT_TRUE(decoded.value().success);
+}
+
+TEST(JsonStructUTest, MissingFieldThrows)
+{
+    TextToSpeech::JsonData::SpeechResponse decoded;
+    EXPECT_THROW(decoded.fromJson({{"speechid", 1}, {"success", true}}), std::invalid_argument);
+    EXPECT_THROW(decoded.fromJson(nlohmann::json::array()), std::invalid_argument);
+}
+
+TEST(JsonStructUTest, DecoderFillsArraysDirectly)
+{
+    nlohmann::json json = nlohmann::json::array({{{"oldState", "initializing"}, {"newState", "active"}},
+                                                 {{"oldState", "active"}, {"newState", "paused"}}});
+
+    auto changes =
+        Internal::Decoder<JSON::NL_Json_Array<Lifecycle::JsonData::StateChange, Lifecycle::StateChange>>::decode(json);
+
+    ASSERT_TRUE(changes);
+    ASSERT_EQ(changes->size(), 2u);
+    EXPECT_EQ((*changes)[0].newState, Lifecycle::LifecycleState::ACTIVE);
+    EXPECT_EQ((*changes)[1].oldState, Lifecycle::LifecycleState::ACTIVE);
+    EXPECT_EQ((*changes)[1].newState, Lifecycle::LifecycleState::PAUSED);
+}
+
+TEST(JsonStructUTest, DecoderReportsMismatchWithoutThrowing)
+{
+    using Changes = JSON::NL_Json_Array<Lifecycle::JsonData::StateChange, Lifecycle::StateChange>;
+    nlohmann::json unknownState = nlohmann::json::array({{{"oldState", "active"}, {"newState", "sleeping"}}});
+    nlohmann::json wrongType = {{"TTS_Status", "0"}, {"success", true}};
+
+    EXPECT_NO_THROW(
+        {
+            EXPECT_EQ(Internal::Decoder<Changes>::decode(unknownState).error(), Error::InvalidParams);
+            EXPECT_EQ(Internal::Decoder<Lifecycle::JsonData::StateChange>::decode({{"oldState", "active"}}).error(),
+                      Error::InvalidParams);
+            EXPECT_EQ(Internal::Decoder<TextToSpeech::JsonData::TTSStatusResponse>::decode(wrongType).error(),
+                      Error::InvalidParams);
+            EXPECT_EQ(Internal::Decoder<Lifecycle::JsonData::LifecycleState>::decode(42).error(), Error::InvalidParams);
+            EXPECT_EQ(Internal::Decoder<JSON::Boolean>::decode("true").error(), Error::InvalidParams);
+        });
+}
+
+TEST(JsonStructUTest, DecoderMovesValueOut)
+{
+    Counted::copies = 0;
+
+    auto values = Internal::Decoder<JSON::NL_Json_Array<CountedJson, Counted>>::decode(
+        nlohmann::json::array({{"a", "b"}, {"c"}}));
+
+    ASSERT_TRUE(values);
+    ASSERT_EQ(values->size(), 2u);
+    EXPECT_EQ((*values)[1].items.front(), "c");
+    EXPECT_EQ(Counted::copies, 0);
+}
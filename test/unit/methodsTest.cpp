@@ -0,0 +1,49 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "methods.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+using Firebolt::Internal::Method;
+using Firebolt::Internal::MethodCount;
+using Firebolt::Internal::methodName;
+using Firebolt::Internal::MethodNames;
+
+static_assert(MethodNames[Method::MetricsMediaPlaying] == "Metrics.mediaPlaying");
+static_assert(MethodNames[Method::Lifecycle2OnStateChanged] == "Lifecycle2.onStateChanged");
+
+TEST(MethodsUTest, EveryMethodHasItsOwnName)
+{
+    std::set<std::string> names;
+    for (std::size_t i = 0; i < MethodCount; ++i)
+    {
+        auto method = static_cast<Method>(i);
+        EXPECT_EQ(methodName(method), MethodNames[method]);
+        EXPECT_NE(methodName(method).find('.'), std::string::npos) << methodName(method);
+        names.insert(methodName(method));
+    }
+    EXPECT_EQ(names.size(), MethodCount);
+}
+
+TEST(MethodsUTest, NameIsBuiltOnce)
+{
+    EXPECT_EQ(&methodName(Method::DeviceUptime), &methodName(Method::DeviceUptime));
+    EXPECT_EQ(methodName(Method::DeviceUptime).data(), methodName(Method::DeviceUptime).data());
+}
@@ -19,6 +19,8 @@
 #include "json_types/metrics.h"
 #include "metrics_impl.h"
 #include "mock_helper.h"
+#include <cstdio>
+#include <future>
 
 class MetricsUTest : public ::testing::Test, protected MockBase
 {
@@ -187,3 +189,246 @@ TEST_F(MetricsUTest, AppInfo)
     auto result = metricsImpl_.appInfo("build123");
     ASSERT_TRUE(result);
 }
+
+TEST_F(MetricsUTest, QueuedCallIsSentInBackground)
+{
+    Firebolt::ClientOptions options;
+    options.metricsQueue = true;
+    metricsImpl_.configure(options);
+
+    std::promise<std::thread::id> sent;
+    auto future = sent.get_future();
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaPlaying", _))
+        .WillOnce(Invoke(
+            [&sent](const std::string& /*methodName*/, const nlohmann::json& /*parameters*/)
+            {
+                sent.set_value(std::this_thread::get_id());
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+
+    auto result = metricsImpl_.mediaPlaying("345", Firebolt::AgePolicy::ADULT);
+    EXPECT_TRUE(result);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+TEST_F(MetricsUTest, QueuedCallErrorReported)
+{
+    std::promise<std::pair<std::string, Firebolt::Error>> reported;
+    auto future = reported.get_future();
+
+    Firebolt::ClientOptions options;
+    options.metricsQueue = true;
+    options.onMetricsError = [&reported](const std::string& method, Firebolt::Error error)
+    { reported.set_value({method, error}); };
+    metricsImpl_.configure(options);
+
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaEnded", _))
+        .WillOnce(Invoke([](const std::string& /*methodName*/, const nlohmann::json& /*parameters*/)
+                         { return Firebolt::Result<void>{Firebolt::Error::NotConnected}; }));
+
+    EXPECT_TRUE(metricsImpl_.mediaEnded("345", std::nullopt));
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    auto [method, error] = future.get();
+    EXPECT_EQ(method, "Metrics.mediaEnded");
+    EXPECT_EQ(error, Firebolt::Error::NotConnected);
+}
+
+TEST_F(MetricsUTest, ReconfigureDoesNotWaitForQueuedCalls)
+{
+    Firebolt::ClientOptions options;
+    options.metricsQueue = true;
+    metricsImpl_.configure(options);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> blocked;
+    std::promise<void> sent;
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaPlay", _))
+        .WillOnce(Invoke(
+            [&](const std::string& /*methodName*/, const nlohmann::json& /*parameters*/)
+            {
+                blocked.set_value();
+                released.wait();
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaEnded", _))
+        .WillOnce(Invoke(
+            [&sent](const std::string& /*methodName*/, const nlohmann::json& /*parameters*/)
+            {
+                sent.set_value();
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+
+    EXPECT_TRUE(metricsImpl_.mediaPlay("345", std::nullopt));
+    ASSERT_EQ(blocked.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(metricsImpl_.mediaEnded("345", std::nullopt));
+
+    // Same options keep the sender, other options replace it; neither waits for the blocked call
+    auto reconfigured = std::async(std::launch::async,
+                                   [&]
+                                   {
+                                       metricsImpl_.configure(options);
+                                       options.metricsQueueCapacity = 64;
+                                       metricsImpl_.configure(options);
+                                   });
+    EXPECT_EQ(reconfigured.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    release.set_value();
+    EXPECT_EQ(sent.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+TEST_F(MetricsUTest, DrainBoundedByTimeout)
+{
+    std::atomic<int> sent{0};
+    std::atomic<int> timedOut{0};
+    Firebolt::ClientOptions options;
+    options.metricsDrainTimeout = std::chrono::milliseconds(50);
+    options.onMetricsError = [&timedOut](const std::string& /*method*/, Firebolt::Error error)
+    {
+        if (error == Firebolt::Error::Timedout)
+        {
+            ++timedOut;
+        }
+    };
+    auto sender = std::make_unique<Firebolt::Metrics::MetricsSender>(
+        [&sent](Firebolt::Internal::Method /*method*/, const nlohmann::json& /*parameters*/)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            ++sent;
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        },
+        options);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(sender->enqueue(Firebolt::Internal::Method::MetricsMediaPlaying, {}, nlohmann::json::object()));
+    }
+
+    // Sending them all would take two seconds
+    auto start = std::chrono::steady_clock::now();
+    sender.reset();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_GT(timedOut.load(), 0);
+    EXPECT_EQ(sent.load() + timedOut.load(), 100);
+}
+
+TEST_F(MetricsUTest, CoalesceRedundantCalls)
+{
+    using Call = Firebolt::Metrics::MetricsSender::Call;
+    using Firebolt::Internal::Method;
+    std::vector<Call> calls{
+        {Method::MetricsMediaPlaying, "a", nlohmann::json({{"entityId", "a"}})},
+        {Method::MetricsMediaPlaying, "a", nlohmann::json({{"entityId", "a"}})},
+        {Method::MetricsMediaPlaying, "b", nlohmann::json({{"entityId", "b"}})},
+        {Method::MetricsMediaRateChanged, "b", nlohmann::json({{"entityId", "b"}, {"rate", 1.0}})},
+        {Method::MetricsMediaRateChanged, "b", nlohmann::json({{"entityId", "b"}, {"rate", 2.0}})},
+        {Method::MetricsMediaSeeked, "b", nlohmann::json({{"entityId", "b"}, {"position", 0.1}})},
+        {Method::MetricsMediaSeeked, "b", nlohmann::json({{"entityId", "b"}, {"position", 0.2}})},
+    };
+
+    Firebolt::Metrics::MetricsSender::coalesce(calls);
+
+    ASSERT_EQ(calls.size(), 5u);
+    EXPECT_EQ(calls[0].entityId, "a");
+    EXPECT_EQ(calls[1].entityId, "b");
+    EXPECT_EQ(calls[2].method, Method::MetricsMediaRateChanged);
+    EXPECT_EQ(calls[2].parameters, nlohmann::json({{"entityId", "b"}, {"rate", 2.0}}));
+    EXPECT_EQ(calls[3].parameters, nlohmann::json({{"entityId", "b"}, {"position", 0.1}}));
+    EXPECT_EQ(calls[4].parameters, nlohmann::json({{"entityId", "b"}, {"position", 0.2}}));
+}
+
+TEST_F(MetricsUTest, QueuedParametersMatchDirectCall)
+{
+    nlohmann::json direct;
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaRenditionChanged", _))
+        .WillOnce(Invoke(
+            [&direct](const std::string& /*methodName*/, const nlohmann::json& parameters)
+            {
+                direct = parameters;
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+    EXPECT_TRUE(
+        metricsImpl_.mediaRenditionChanged("a \"quoted\"\n", 5000, 1920, 1080, "HDR", Firebolt::AgePolicy::TEEN));
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    Firebolt::ClientOptions options;
+    options.metricsQueue = true;
+    metricsImpl_.configure(options);
+
+    std::promise<nlohmann::json> queued;
+    auto future = queued.get_future();
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaRenditionChanged", _))
+        .WillOnce(Invoke(
+            [&queued](const std::string& /*methodName*/, const nlohmann::json& parameters)
+            {
+                queued.set_value(parameters);
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+    EXPECT_TRUE(
+        metricsImpl_.mediaRenditionChanged("a \"quoted\"\n", 5000, 1920, 1080, "HDR", Firebolt::AgePolicy::TEEN));
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get(), direct);
+}
+
+TEST_F(MetricsUTest, DelayedCallsCoalesced)
+{
+    Firebolt::ClientOptions options;
+    options.metricsQueue = true;
+    options.metricsCoalesce = true;
+    options.metricsCoalesceDelay = std::chrono::seconds(10);
+    options.metricsCoalesceLimit = 4;
+    metricsImpl_.configure(options);
+
+    std::promise<void> done;
+    auto future = done.get_future();
+    nlohmann::json lastRate;
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaPlaying", _))
+        .WillOnce(Invoke([](const std::string& /*methodName*/, const nlohmann::json& /*parameters*/)
+                         { return Firebolt::Result<void>{Firebolt::Error::None}; }));
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaRateChanged", _))
+        .WillOnce(Invoke(
+            [&](const std::string& /*methodName*/, const nlohmann::json& parameters)
+            {
+                lastRate = parameters["rate"];
+                done.set_value();
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+
+    EXPECT_TRUE(metricsImpl_.mediaPlaying("345", std::nullopt));
+    EXPECT_TRUE(metricsImpl_.mediaPlaying("345", std::nullopt));
+    EXPECT_TRUE(metricsImpl_.mediaRateChanged("345", 1.5, std::nullopt));
+    EXPECT_TRUE(metricsImpl_.mediaRateChanged("345", 2.0, std::nullopt));
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(lastRate, 2.0);
+}
+
+TEST_F(MetricsUTest, DisconnectedCallReplayedFromOutbox)
+{
+    Firebolt::ClientOptions options;
+    options.outboxDirectory = ::testing::TempDir();
+    std::remove((options.outboxDirectory + "/metrics.outbox").c_str());
+    metricsImpl_.configure(options);
+    metricsImpl_.onConnectionChanged(false);
+
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaPlay", _)).Times(0);
+    EXPECT_TRUE(metricsImpl_.mediaPlay("345", std::nullopt));
+    ::testing::Mock::VerifyAndClearExpectations(&mockHelper);
+
+    std::promise<nlohmann::json> replayed;
+    auto future = replayed.get_future();
+    EXPECT_CALL(mockHelper, invoke("Metrics.mediaPlay", _))
+        .WillOnce(Invoke(
+            [&replayed](const std::string& /*methodName*/, const nlohmann::json& parameters)
+            {
+                replayed.set_value(parameters);
+                return Firebolt::Result<void>{Firebolt::Error::None};
+            }));
+    metricsImpl_.onConnectionChanged(true);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get()["entityId"], "345");
+}
@@ -20,9 +20,11 @@
 
 #include "json_engine.h"
 #include <algorithm>
+#include <any>
 #include <firebolt/helpers.h>
 #include <firebolt/json_types.h>
 #include <gmock/gmock.h>
+#include <map>
 
 class MockHelper : public Firebolt::Helpers::IHelper
 {
@@ -48,13 +50,12 @@ public:
 class MockBase
 {
 protected:
-    template <typename T>
-    void validate_enum(const std::string& enumName, const nlohmann::json& enums,
-                       const Firebolt::JSON::EnumType<T>& enumType)
+    template <typename EnumTable>
+    void validate_enum(const std::string& enumName, const nlohmann::json& enums, const EnumTable& enumType)
     {
         for (const auto& expectedValue : enumType)
         {
-            EXPECT_TRUE(std::find(enums.begin(), enums.end(), expectedValue.first) != enums.end())
+            EXPECT_TRUE(std::find(enums.begin(), enums.end(), std::string(expectedValue.first)) != enums.end())
                 << "Expected enum value: " << expectedValue.first
                 << " not found in OpenRPC schema for enum: " << enumName;
         }
@@ -67,7 +68,7 @@ protected:
                 << " is not defined in sources";
         }
     }
-    template <typename T> void validate_enum(const std::string& enumName, const Firebolt::JSON::EnumType<T>& enumType)
+    template <typename EnumTable> void validate_enum(const std::string& enumName, const EnumTable& enumType)
     {
         validate_enum(enumName, jsonEngine["components"]["schemas"][enumName]["enum"], enumType);
     }
@@ -137,8 +138,33 @@ protected:
                 Invoke([&](Firebolt::SubscriptionId /*id*/) { return Firebolt::Result<void>{Firebolt::Error::None}; }));
     }
 
+    struct EventSubscription
+    {
+        std::any notification;
+        void (*callback)(void*, const nlohmann::json&) = nullptr;
+    };
+
+    void mockEventSource(const std::string& eventName, Firebolt::SubscriptionId id = 1)
+    {
+        EXPECT_CALL(mockHelper, subscribe(_, eventName, _, _))
+            .WillRepeatedly(Invoke(
+                [this, id](void* /*owner*/, const std::string& eventName, std::any&& notification,
+                           void (*callback)(void*, const nlohmann::json&))
+                {
+                    eventSubscriptions[eventName] = EventSubscription{std::move(notification), callback};
+                    return Firebolt::Result<Firebolt::SubscriptionId>{id};
+                }));
+    }
+
+    void emitEvent(const std::string& eventName, const nlohmann::json& payload)
+    {
+        auto& subscription = eventSubscriptions.at(eventName);
+        subscription.callback(&subscription.notification, payload);
+    }
+
 protected:
     JsonEngine jsonEngine;
     nlohmann::json lastSetParams;
     ::testing::NiceMock<MockHelper> mockHelper;
+    std::map<std::string, EventSubscription> eventSubscriptions;
 };
@@ -37,6 +37,36 @@ TEST_F(NetworkUTest, Connected)
     EXPECT_EQ(*result, expectedValue.get<bool>());
 }
 
+TEST_F(NetworkUTest, ConnectedFromPropertyCache)
+{
+    Firebolt::ClientOptions options;
+    options.propertyCache = true;
+    networkImpl_.configure(options);
+
+    mockEventSource("Network.onConnectedChanged");
+    mock("Network.connected");
+    auto expectedValue = jsonEngine.get_value("Network.connected").get<bool>();
+
+    auto result = networkImpl_.connected();
+    ASSERT_TRUE(result) << "NetworkImpl::connected() returned an error";
+    EXPECT_EQ(*result, expectedValue);
+
+    result = networkImpl_.connected();
+    ASSERT_TRUE(result) << "NetworkImpl::connected() did not return the cached value";
+    EXPECT_EQ(*result, expectedValue);
+
+    emitEvent("Network.onConnectedChanged", !expectedValue);
+    result = networkImpl_.connected();
+    ASSERT_TRUE(result) << "NetworkImpl::connected() did not return the updated value";
+    EXPECT_EQ(*result, !expectedValue);
+
+    networkImpl_.onConnectionChanged(false);
+    mock("Network.connected");
+    result = networkImpl_.connected();
+    ASSERT_TRUE(result) << "NetworkImpl::connected() did not fetch the value after invalidation";
+    EXPECT_EQ(*result, expectedValue);
+}
+
 TEST_F(NetworkUTest, SubscribeOnConnectedChanged)
 {
     nlohmann::json expectedValue = 1;
@@ -0,0 +1,272 @@
+/**
+ * Copyright 2026 Comcast Cable Communications Management, LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "outbox.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+
+class OutboxUTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        path_ = ::testing::TempDir() + "outbox_" + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        std::remove(path_.c_str());
+    }
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    std::string path_;
+};
+
+TEST_F(OutboxUTest, ReplayedInOrderAfterReopen)
+{
+    {
+        Firebolt::Internal::Outbox outbox{path_, 4096};
+        ASSERT_TRUE(outbox.isOpen());
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_TRUE(outbox.append("Metrics.mediaPlaying", {{"entityId", std::to_string(i)}}));
+        }
+    }
+
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    ASSERT_EQ(outbox.size(), 3u);
+    std::vector<std::string> sent;
+    outbox.flush(
+        [&sent](const std::string& method, const nlohmann::json& parameters)
+        {
+            EXPECT_EQ(method, "Metrics.mediaPlaying");
+            sent.push_back(parameters["entityId"]);
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        });
+    EXPECT_EQ(sent, (std::vector<std::string>{"0", "1", "2"}));
+    EXPECT_EQ(outbox.size(), 0u);
+}
+
+TEST_F(OutboxUTest, UndeliveredCallsKept)
+{
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    outbox.append("Metrics.mediaPlay", {{"entityId", "a"}});
+    outbox.append("Metrics.mediaPause", {{"entityId", "a"}});
+
+    int calls = 0;
+    outbox.flush(
+        [&calls](const std::string& /*method*/, const nlohmann::json& /*parameters*/)
+        {
+            return Firebolt::Result<void>{++calls == 1 ? Firebolt::Error::None : Firebolt::Error::NotConnected};
+        });
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(outbox.size(), 1u);
+}
+
+TEST_F(OutboxUTest, TimedOutCallsNotKept)
+{
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    outbox.append("Discovery.watched", {{"entityId", "a"}});
+
+    int calls = 0;
+    EXPECT_TRUE(outbox.flush(
+        [&calls](const std::string& /*method*/, const nlohmann::json& /*parameters*/)
+        {
+            ++calls;
+            return Firebolt::Result<void>{Firebolt::Error::Timedout};
+        }));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(outbox.size(), 0u);
+    EXPECT_FALSE(Firebolt::Internal::Outbox::isUndelivered(Firebolt::Error::Timedout));
+}
+
+TEST_F(OutboxUTest, DeliverStoresWhatCannotBeSent)
+{
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    int calls = 0;
+    auto invoke = [&calls](Firebolt::Error error)
+    {
+        return [&calls, error]
+        {
+            ++calls;
+            return Firebolt::Result<void>{error};
+        };
+    };
+
+    EXPECT_TRUE(outbox.deliver("A", nlohmann::json::object(), false, invoke(Firebolt::Error::None)));
+    EXPECT_EQ(calls, 0);
+    EXPECT_TRUE(outbox.deliver("B", nlohmann::json::object(), true, invoke(Firebolt::Error::NotConnected)));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(outbox.size(), 2u);
+
+    EXPECT_TRUE(outbox.deliver("C", nlohmann::json::object(), true, invoke(Firebolt::Error::None)));
+    auto timedOut = outbox.deliver("D", nlohmann::json::object(), true, invoke(Firebolt::Error::Timedout));
+    ASSERT_FALSE(timedOut);
+    EXPECT_EQ(timedOut.error(), Firebolt::Error::Timedout);
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(outbox.size(), 2u);
+}
+
+TEST_F(OutboxUTest, UnreadableCallsDroppedAndCounted)
+{
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    outbox.append("Metrics.mediaPlay", {{"entityId", "a"}});
+    outbox.append("Metrics.mediaPause", std::string_view("{\"entityId\":"));
+    outbox.append("Metrics.mediaEnded", {{"entityId", "a"}});
+
+    std::vector<std::string> sent;
+    EXPECT_TRUE(outbox.flush(
+        [&sent](const std::string& method, const nlohmann::json& parameters)
+        {
+            EXPECT_FALSE(parameters.is_discarded());
+            sent.push_back(method);
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        }));
+    EXPECT_EQ(sent, (std::vector<std::string>{"Metrics.mediaPlay", "Metrics.mediaEnded"}));
+    EXPECT_EQ(outbox.discarded(), 1u);
+    EXPECT_EQ(outbox.size(), 0u);
+}
+
+TEST_F(OutboxUTest, OldestDroppedWhenFull)
+{
+    Firebolt::Internal::Outbox outbox{path_, 1024};
+    const std::string filler(100, 'x');
+    for (int i = 0; i < 50; ++i)
+    {
+        EXPECT_TRUE(outbox.append("Metrics.event", {{"schema", std::to_string(i)}, {"data", filler}}));
+    }
+    ASSERT_GT(outbox.size(), 0u);
+    ASSERT_LT(outbox.size(), 50u);
+
+    std::vector<int> sent;
+    outbox.flush(
+        [&sent](const std::string& /*method*/, const nlohmann::json& parameters)
+        {
+            sent.push_back(std::stoi(parameters["schema"].get<std::string>()));
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        });
+    ASSERT_FALSE(sent.empty());
+    EXPECT_EQ(sent.back(), 49);
+    for (std::size_t i = 1; i < sent.size(); ++i)
+    {
+        EXPECT_EQ(sent[i], sent[i - 1] + 1);
+    }
+}
+
+TEST_F(OutboxUTest, RingFilledToItsEndSurvivesReopen)
+{
+    // Two records of half the ring each end exactly at its end
+    const std::string parameters = '"' + std::string(1024 / 2 - 4 - 2 - 2, 'x') + '"';
+    {
+        Firebolt::Internal::Outbox outbox{path_, 1024};
+        EXPECT_TRUE(outbox.append("A", std::string_view(parameters)));
+        EXPECT_TRUE(outbox.append("B", std::string_view(parameters)));
+    }
+
+    Firebolt::Internal::Outbox outbox{path_, 1024};
+    ASSERT_EQ(outbox.size(), 2u);
+    EXPECT_TRUE(outbox.append("C", std::string_view(parameters)));
+    std::vector<std::string> sent;
+    outbox.flush(
+        [&sent](const std::string& method, const nlohmann::json& /*parameters*/)
+        {
+            sent.push_back(method);
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        });
+    EXPECT_EQ(sent, (std::vector<std::string>{"B", "C"}));
+}
+
+TEST_F(OutboxUTest, OpenSharesTheOutboxOfAPath)
+{
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox = Firebolt::Internal::Outbox::open(path_, 4096);
+    ASSERT_TRUE(outbox);
+    EXPECT_EQ(Firebolt::Internal::Outbox::open(path_, 4096), outbox);
+    EXPECT_FALSE(Firebolt::Internal::Outbox::open(::testing::TempDir() + "missing/outbox", 4096));
+}
+
+TEST_F(OutboxUTest, FileLockedWhileOpen)
+{
+    {
+        Firebolt::Internal::Outbox outbox{path_, 4096};
+        ASSERT_TRUE(outbox.isOpen());
+        // A separate open of the file, as in another process, does not get the lock
+        Firebolt::Internal::Outbox other{path_, 4096};
+        EXPECT_FALSE(other.isOpen());
+    }
+    Firebolt::Internal::Outbox outbox{path_, 4096};
+    EXPECT_TRUE(outbox.isOpen());
+}
+
+TEST_F(OutboxUTest, CallsMadeWhileReplayingAreSentAfterIt)
+{
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox = Firebolt::Internal::Outbox::open(path_, 4096);
+    ASSERT_TRUE(outbox);
+    EXPECT_FALSE(outbox->appendIfReplaying("Direct", nlohmann::json::object()));
+    EXPECT_TRUE(outbox->append("A", nlohmann::json::object()));
+    EXPECT_TRUE(outbox->append("B", nlohmann::json::object()));
+
+    std::vector<std::string> sent;
+    outbox->replay(
+        [&sent, &outbox](const std::string& method, const nlohmann::json& /*parameters*/)
+        {
+            if (method == "A")
+            {
+                // A call made meanwhile waits for the stored ones
+                EXPECT_TRUE(outbox->appendIfReplaying("C", nlohmann::json::object()));
+            }
+            sent.push_back(method);
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        });
+    outbox->waitForReplay();
+    EXPECT_EQ(sent, (std::vector<std::string>{"A", "B", "C"}));
+    EXPECT_EQ(outbox->size(), 0u);
+    EXPECT_FALSE(outbox->appendIfReplaying("Direct", nlohmann::json::object()));
+}
+
+TEST_F(OutboxUTest, TornRecordDiscardedAndReplayEnds)
+{
+    {
+        Firebolt::Internal::Outbox outbox{path_, 4096};
+        ASSERT_TRUE(outbox.append("A", nlohmann::json::object()));
+    }
+    {
+        // The header is followed by the ring, whose first record starts with its length
+        std::fstream file{path_, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekg(0, std::ios::end);
+        std::streamoff headerSize = static_cast<std::streamoff>(file.tellg()) - 4096;
+        uint32_t overlong = 0x7fffffff;
+        file.seekp(headerSize);
+        file.write(reinterpret_cast<const char*>(&overlong), sizeof(overlong));
+    }
+
+    std::shared_ptr<Firebolt::Internal::Outbox> outbox = Firebolt::Internal::Outbox::open(path_, 4096);
+    ASSERT_TRUE(outbox);
+    ASSERT_EQ(outbox->size(), 1u);
+    int calls = 0;
+    outbox->replay(
+        [&calls](const std::string& /*method*/, const nlohmann::json& /*parameters*/)
+        {
+            ++calls;
+            return Firebolt::Result<void>{Firebolt::Error::None};
+        });
+    outbox->waitForReplay();
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(outbox->size(), 0u);
+    EXPECT_EQ(outbox->discarded(), 1u);
+    // Later calls are sent directly again
+    EXPECT_FALSE(outbox->appendIfReplaying("B", nlohmann::json::object()));
+}